@@ -0,0 +1,59 @@
+/**
+ * @file BenchSupport.h
+ * @brief Timing helpers for the SmallBiz benchmark programs
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * Each file in bench/ is a standalone program run by "make bench", built
+ * with optimization against its own objects. A program takes an optional
+ * largest size as its first argument (make bench BENCH_ARGS=100000), so a
+ * machine without room for 10M rows can still run the smaller sizes.
+ */
+
+#ifndef BENCHSUPPORT_H
+#define BENCHSUPPORT_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+
+/**
+ * @brief Time a callable once
+ * @param func Work to time
+ * @return Elapsed wall time in milliseconds
+ */
+template <typename Func>
+double timeMs(Func func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+/**
+ * @brief Read the largest size to run from the command line
+ * @param argc Argument count from main
+ * @param argv Arguments from main
+ * @param fallback Largest size when no argument is given
+ * @return Requested limit, or fallback
+ */
+inline std::size_t benchMaxSize(int argc, char* argv[], std::size_t fallback) {
+    if (argc > 1) {
+        std::size_t size = std::strtoull(argv[1], nullptr, 10);
+        if (size > 0) {
+            return size;
+        }
+    }
+    return fallback;
+}
+
+/**
+ * @brief Print a result the optimizer could otherwise discard
+ * @param checksum Value derived from every timed result
+ */
+inline void printChecksum(unsigned long long checksum) {
+    std::cout << "(checksum " << checksum << ")\n" << std::endl;
+}
+
+#endif // BENCHSUPPORT_H
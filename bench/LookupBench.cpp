@@ -0,0 +1,82 @@
+/**
+ * @file LookupBench.cpp
+ * @brief SKU lookup latency: SkuIndex against std::map
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * Fills a SkuIndex and a std::map<std::string_view, uint32_t> with the
+ * same TOOL-n SKUs, then times 2M random successful lookups in
+ * each at 1K, 1M and 10M SKUs.
+ */
+
+#include "BenchSupport.h"
+#include "SkuIndex.h"
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+const std::size_t LOOKUPS = 2000000;
+
+void runSize(std::size_t count, unsigned long long& checksum) {
+    std::vector<std::string> skus;
+    skus.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        skus.push_back("TOOL-" + std::to_string(i));
+    }
+    SkuIndex index;
+    std::map<std::string_view, std::uint32_t> tree;
+    for (std::size_t i = 0; i < count; ++i) {
+        index.insert(skus[i], static_cast<std::uint32_t>(i));
+        tree.emplace(skus[i], static_cast<std::uint32_t>(i));
+    }
+
+    // Probe order is drawn up front so both structures see the same keys
+    std::mt19937 rng(31);
+    std::vector<std::uint32_t> probes(LOOKUPS);
+    for (std::uint32_t& probe : probes) {
+        probe = static_cast<std::uint32_t>(rng() % count);
+    }
+
+    double indexMs = timeMs([&]() {
+        for (std::uint32_t probe : probes) {
+            std::uint32_t value = 0;
+            index.find(skus[probe], value);
+            checksum += value;
+        }
+    });
+    double treeMs = timeMs([&]() {
+        for (std::uint32_t probe : probes) {
+            checksum += tree.find(skus[probe])->second;
+        }
+    });
+    std::cout << std::left << std::setw(10) << count << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << indexMs * 1e6 / LOOKUPS << std::setw(12) << treeMs * 1e6 / LOOKUPS
+              << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::size_t maxSize = benchMaxSize(argc, argv, 10000000);
+    std::cout << "SKU lookups (" << LOOKUPS << " random hits, ns per lookup)\n"
+              << std::left << std::setw(10) << "SKUs" << std::right << std::setw(10) << "SkuIndex"
+              << std::setw(12) << "std::map" << std::endl;
+    unsigned long long checksum = 0;
+    for (std::size_t count : {std::size_t(1000), std::size_t(1000000), std::size_t(10000000)}) {
+        count = std::min(count, maxSize);
+        runSize(count, checksum);
+        if (count == maxSize) {
+            break;
+        }
+    }
+    printChecksum(checksum);
+    return 0;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file SearchBench.cpp
+ * @brief Name search latency: trigram index against a full scan
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * Times searchByName, which verifies only the candidates under the
+ * term's rarest trigram, against the scan it replaced (lower-case every
+ * name and std::string::find) at 1M products. The query cache is turned
+ * off so every call does the search.
+ */
+
+#include "BenchSupport.h"
+#include "Inventory.h"
+#include "StringUtils.h"
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+const char* const ADJECTIVES[] = {"Ultra", "Pro", "Compact", "Deluxe", "Basic", "Smart"};
+const char* const NOUNS[] = {"Lamp", "Keyboard", "Drill", "Chair", "Monitor", "Router", "Desk",
+                             "Cable", "Speaker", "Widget", "Stapler", "Heater"};
+const int REPEATS = 5;
+
+/**
+ * The search the trigram index replaced
+ */
+std::vector<ProductHandle> scanByName(const Inventory& inventory, const std::vector<ProductHandle>& all,
+                                      const std::string& term) {
+    std::vector<ProductHandle> results;
+    const std::string lowerTerm = toLowerCopy(term);
+    for (ProductHandle handle : all) {
+        if (toLowerCopy(inventory.resolve(handle)->getName()).find(lowerTerm) != std::string::npos) {
+            results.push_back(handle);
+        }
+    }
+    return results;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::size_t count = benchMaxSize(argc, argv, 1000000);
+    Inventory inventory("bench_unused.csv");
+    for (std::size_t i = 0; i < count; ++i) {
+        std::string name = std::string(ADJECTIVES[i % 6]) + " " + NOUNS[(i / 6) % 12] + " " +
+                           std::to_string(i % 100000);
+        inventory.addProduct(new PhysicalProduct("S" + std::to_string(i), name, Money::fromCents(999), 1,
+                                                 "Tools", 1.0, "Acme"));
+    }
+    inventory.setQueryCacheCapacity(0);
+    const std::vector<ProductHandle> all = inventory.findAll(Query::everything());
+
+    std::cout << "Name search at " << count << " products (ms per query, mean of " << REPEATS << ")\n"
+              << std::left << std::setw(16) << "Term" << std::right << std::setw(10) << "Matches"
+              << std::setw(10) << "Trigram" << std::setw(10) << "Scan" << std::endl;
+    unsigned long long checksum = 0;
+    for (const std::string term : {"zzz", "12345", "ultra lamp", "pro", "keyboard"}) {
+        std::vector<ProductHandle> indexed;
+        std::vector<ProductHandle> scanned;
+        double indexMs = timeMs([&]() {
+            for (int i = 0; i < REPEATS; ++i) {
+                indexed = inventory.searchByName(term);
+            }
+        });
+        double scanMs = timeMs([&]() {
+            for (int i = 0; i < REPEATS; ++i) {
+                scanned = scanByName(inventory, all, term);
+            }
+        });
+        if (indexed != scanned) {
+            std::cerr << "[!] Results differ for \"" << term << "\"" << std::endl;
+            return 1;
+        }
+        checksum += indexed.size();
+        std::cout << std::left << std::setw(16) << ("\"" + term + "\"") << std::right << std::setw(10)
+                  << indexed.size() << std::fixed << std::setprecision(2) << std::setw(10)
+                  << indexMs / REPEATS << std::setw(10) << scanMs / REPEATS << std::endl;
+    }
+    printChecksum(checksum);
+    return 0;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file SortBench.cpp
+ * @brief Sort kernels: radixSort against std::sort, parallelSort by thread count
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * The radix table sorts (key, slot) pairs the way numeric views are
+ * built: price keys of up to 17 bits through orderedKey, and quantity
+ * keys below 1000, at 1M and 10M rows. The scaling table sorts 1M SKU
+ * strings with parallelSort at 1 to 8 threads. Real scaling needs that
+ * many hardware threads; the count this machine reports is printed
+ * first, and every result is checked against the serial sort.
+ */
+
+#include "BenchSupport.h"
+#include "ParallelSort.h"
+#include "RadixSort.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+const std::size_t SCALING_ROWS = 1000000;
+
+/**
+ * @return Milliseconds for radixSort and for std::sort on the same pairs
+ */
+std::pair<double, double> compareRadix(const std::vector<std::uint64_t>& source, unsigned long long& checksum) {
+    std::vector<std::uint64_t> keys = source;
+    std::vector<std::uint32_t> slots(keys.size());
+    for (std::size_t i = 0; i < slots.size(); ++i) {
+        slots[i] = static_cast<std::uint32_t>(i);
+    }
+    std::vector<std::pair<std::uint64_t, std::uint32_t>> pairs(keys.size());
+    for (std::size_t i = 0; i < pairs.size(); ++i) {
+        pairs[i] = {keys[i], slots[i]};
+    }
+
+    double radixMs = timeMs([&]() {
+        radixSort(keys, slots);
+    });
+    double sortMs = timeMs([&]() {
+        std::sort(pairs.begin(), pairs.end());
+    });
+    // Both are stable by slot, so they must agree exactly
+    for (std::size_t i = 0; i < pairs.size(); ++i) {
+        if (pairs[i].first != keys[i] || pairs[i].second != slots[i]) {
+            std::cerr << "[!] radixSort and std::sort disagree at row " << i << std::endl;
+            std::exit(1);
+        }
+    }
+    checksum += slots.empty() ? 0 : slots.front();
+    return {radixMs, sortMs};
+}
+
+void radixTable(std::size_t maxSize, unsigned long long& checksum) {
+    std::cout << "Radix sort vs std::sort on (key, slot) pairs (ms)\n"
+              << std::left << std::setw(10) << "Rows" << std::setw(10) << "Key" << std::right
+              << std::setw(10) << "radix" << std::setw(12) << "std::sort" << std::endl;
+    std::mt19937_64 rng(46);
+    for (std::size_t rows : {std::size_t(1000000), std::size_t(10000000)}) {
+        rows = std::min(rows, maxSize);
+        std::vector<std::uint64_t> keys(rows);
+        for (int pass = 0; pass < 2; ++pass) {
+            const bool price = pass == 0;
+            for (std::uint64_t& key : keys) {
+                key = price ? orderedKey(static_cast<std::int64_t>(rng() % 100000)) : rng() % 1000;
+            }
+            std::pair<double, double> ms = compareRadix(keys, checksum);
+            std::cout << std::left << std::setw(10) << rows << std::setw(10) << (price ? "price" : "quantity")
+                      << std::right << std::fixed << std::setprecision(1) << std::setw(10) << ms.first
+                      << std::setw(12) << ms.second << std::endl;
+        }
+        if (rows == maxSize) {
+            break;
+        }
+    }
+    std::cout << std::endl;
+}
+
+void scalingTable(std::size_t maxSize, unsigned long long& checksum) {
+    const std::size_t rows = std::min(SCALING_ROWS, maxSize);
+    std::vector<std::string> skus(rows);
+    std::mt19937 rng(47);
+    for (std::string& sku : skus) {
+        sku = "TOOL-" + std::to_string(rng());
+    }
+    std::vector<std::string> expected = skus;
+    std::sort(expected.begin(), expected.end());
+
+    std::cout << "parallelSort of " << rows << " SKU strings (hardware threads: "
+              << std::thread::hardware_concurrency() << ")\n"
+              << std::left << std::setw(10) << "Threads" << std::right << std::setw(10) << "ms" << std::endl;
+    for (unsigned threads : {1u, 2u, 4u, 8u}) {
+        std::vector<std::string> sorted = skus;
+        double ms = timeMs([&]() {
+            parallelSort(sorted.begin(), sorted.end(), std::less<std::string>(), threads);
+        });
+        if (sorted != expected) {
+            std::cerr << "[!] parallelSort with " << threads << " threads differs from std::sort" << std::endl;
+            std::exit(1);
+        }
+        checksum += sorted.empty() ? 0 : sorted.front().size();
+        std::cout << std::left << std::setw(10) << threads << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(10) << ms << std::endl;
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const std::size_t maxSize = benchMaxSize(argc, argv, 10000000);
+    unsigned long long checksum = 0;
+    radixTable(maxSize, checksum);
+    scalingTable(maxSize, checksum);
+    printChecksum(checksum);
+    return 0;
+}
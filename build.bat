@@ -15,7 +15,7 @@ if %ERRORLEVEL% EQU 0 (
     echo Compiling with MSVC...
     
     if not exist "build" mkdir build
-    cl /EHsc /Fe:SmallBiz.exe src\main.cpp src\Product.cpp src\PhysicalProduct.cpp src\DigitalProduct.cpp src\Inventory.cpp /Fobuild\
+    cl /EHsc /std:c++17 /Fe:SmallBiz.exe src\main.cpp src\Product.cpp src\PhysicalProduct.cpp src\DigitalProduct.cpp src\Inventory.cpp src\Money.cpp src\StringUtils.cpp src\SkuIndex.cpp src\TrigramIndex.cpp src\Bitmap.cpp src\Query.cpp src\ValueHistogram.cpp src\FilterKernels.cpp src\RadixSort.cpp src\SortSpec.cpp src\QueryCache.cpp /Fobuild\
     
     if %ERRORLEVEL% EQU 0 (
         echo.
@@ -34,7 +34,7 @@ if %ERRORLEVEL% EQU 0 (
     echo Compiling with g++...
     
     if not exist "build" mkdir build
-    g++ -std=c++17 -Wall -o SmallBiz.exe src\main.cpp src\Product.cpp src\PhysicalProduct.cpp src\DigitalProduct.cpp src\Inventory.cpp
+    g++ -std=c++17 -Wall -pthread -o SmallBiz.exe src\main.cpp src\Product.cpp src\PhysicalProduct.cpp src\DigitalProduct.cpp src\Inventory.cpp src\Money.cpp src\StringUtils.cpp src\SkuIndex.cpp src\TrigramIndex.cpp src\Bitmap.cpp src\Query.cpp src\ValueHistogram.cpp src\FilterKernels.cpp src\RadixSort.cpp src\SortSpec.cpp src\QueryCache.cpp
     
     if %ERRORLEVEL% EQU 0 (
         echo.
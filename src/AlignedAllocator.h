@@ -0,0 +1,68 @@
+/**
+ * @file AlignedAllocator.h
+ * @brief Cache-line aligned STL allocator for SmallBiz Inventory System
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * This file defines AlignedAllocator, a minimal allocator that makes
+ * std::vector storage start on a cache-line boundary. Inventory uses it
+ * for the dense numeric columns scanned by reports and filters.
+ */
+
+#ifndef ALIGNEDALLOCATOR_H
+#define ALIGNEDALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/// Size of one CPU cache line in bytes
+const std::size_t CACHE_LINE_SIZE = 64;
+
+/**
+ * @class AlignedAllocator
+ * @brief Allocator returning storage aligned to Alignment bytes
+ * @tparam T Element type
+ * @tparam Alignment Required alignment (power of two)
+ */
+template <typename T, std::size_t Alignment = CACHE_LINE_SIZE>
+class AlignedAllocator {
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) {
+    }
+
+    T* allocate(std::size_t count) {
+        return static_cast<T*>(::operator new(count * sizeof(T),
+                                              std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T* pointer, std::size_t) {
+        ::operator delete(pointer, std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const {
+        return false;
+    }
+};
+
+/// Cache-line aligned vector used for hot numeric columns
+template <typename T>
+using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+#endif // ALIGNEDALLOCATOR_H
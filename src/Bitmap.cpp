@@ -0,0 +1,252 @@
+/**
+ * @file Bitmap.cpp
+ * @brief Implementation of the roaring-style compressed bitmap
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * A bitset container is converted back to an array only once it falls to
+ * half the array limit, so an id count hovering around the limit does not
+ * convert on every add/remove.
+ */
+
+#include "Bitmap.h"
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// ==================== BIT HELPERS ====================
+
+static std::uint32_t popCount(std::uint64_t word) {
+#if defined(_MSC_VER)
+    return static_cast<std::uint32_t>(__popcnt64(word));
+#else
+    return static_cast<std::uint32_t>(__builtin_popcountll(word));
+#endif
+}
+
+static std::uint32_t trailingZeros(std::uint64_t word) {
+#if defined(_MSC_VER)
+    unsigned long bit;
+    _BitScanForward64(&bit, word);
+    return static_cast<std::uint32_t>(bit);
+#else
+    return static_cast<std::uint32_t>(__builtin_ctzll(word));
+#endif
+}
+
+// ==================== CONSTRUCTOR ====================
+
+Bitmap::Bitmap() : count(0) {
+}
+
+// ==================== PRIVATE HELPERS ====================
+
+size_t Bitmap::lowerBound(std::uint16_t key) const {
+    auto it = std::lower_bound(containers.begin(), containers.end(), key,
+        [](const Container& container, std::uint16_t value) {
+            return container.key < value;
+        });
+    return static_cast<size_t>(it - containers.begin());
+}
+
+void Bitmap::toBitset(Container& container) {
+    container.words.assign(BITSET_WORDS, 0);
+    for (std::uint16_t low : container.array) {
+        container.words[low >> 6] |= std::uint64_t(1) << (low & 63);
+    }
+    std::vector<std::uint16_t>().swap(container.array);
+}
+
+void Bitmap::toArray(Container& container) {
+    container.array.clear();
+    container.array.reserve(container.cardinality);
+    for (size_t i = 0; i < BITSET_WORDS; ++i) {
+        std::uint64_t word = container.words[i];
+        while (word != 0) {
+            container.array.push_back(static_cast<std::uint16_t>((i << 6) + trailingZeros(word)));
+            word &= word - 1;
+        }
+    }
+    std::vector<std::uint64_t>().swap(container.words);
+}
+
+void Bitmap::intersect(const Container& a, const Container& b, Container& result) {
+    result.key = a.key;
+    result.cardinality = 0;
+    if (a.isBitset() && b.isBitset()) {
+        // Word-wise AND, then shrink to an array if the result is sparse
+        result.words.resize(BITSET_WORDS);
+        for (size_t i = 0; i < BITSET_WORDS; ++i) {
+            result.words[i] = a.words[i] & b.words[i];
+            result.cardinality += popCount(result.words[i]);
+        }
+        if (result.cardinality <= ARRAY_LIMIT) {
+            toArray(result);
+        }
+        return;
+    }
+    if (a.isBitset() || b.isBitset()) {
+        // Probe the bitset for each entry of the array
+        const Container& array = a.isBitset() ? b : a;
+        const Container& bits = a.isBitset() ? a : b;
+        for (std::uint16_t low : array.array) {
+            if (bits.words[low >> 6] & (std::uint64_t(1) << (low & 63))) {
+                result.array.push_back(low);
+            }
+        }
+    } else {
+        std::set_intersection(a.array.begin(), a.array.end(),
+                              b.array.begin(), b.array.end(),
+                              std::back_inserter(result.array));
+    }
+    result.cardinality = static_cast<std::uint32_t>(result.array.size());
+}
+
+// ==================== PUBLIC INTERFACE ====================
+
+bool Bitmap::add(std::uint32_t id) {
+    std::uint16_t key = static_cast<std::uint16_t>(id >> 16);
+    std::uint16_t low = static_cast<std::uint16_t>(id & 0xFFFF);
+    size_t position = lowerBound(key);
+    if (position == containers.size() || containers[position].key != key) {
+        Container container;
+        container.key = key;
+        containers.insert(containers.begin() + position, container);
+    }
+
+    Container& container = containers[position];
+    if (container.isBitset()) {
+        std::uint64_t& word = container.words[low >> 6];
+        std::uint64_t bit = std::uint64_t(1) << (low & 63);
+        if (word & bit) {
+            return false;
+        }
+        word |= bit;
+    } else {
+        auto it = std::lower_bound(container.array.begin(), container.array.end(), low);
+        if (it != container.array.end() && *it == low) {
+            return false;
+        }
+        container.array.insert(it, low);
+        if (container.array.size() > ARRAY_LIMIT) {
+            toBitset(container);
+        }
+    }
+    container.cardinality++;
+    count++;
+    return true;
+}
+
+bool Bitmap::remove(std::uint32_t id) {
+    std::uint16_t key = static_cast<std::uint16_t>(id >> 16);
+    std::uint16_t low = static_cast<std::uint16_t>(id & 0xFFFF);
+    size_t position = lowerBound(key);
+    if (position == containers.size() || containers[position].key != key) {
+        return false;
+    }
+
+    Container& container = containers[position];
+    if (container.isBitset()) {
+        std::uint64_t& word = container.words[low >> 6];
+        std::uint64_t bit = std::uint64_t(1) << (low & 63);
+        if (!(word & bit)) {
+            return false;
+        }
+        word &= ~bit;
+        container.cardinality--;
+        if (container.cardinality <= ARRAY_LIMIT / 2) {
+            toArray(container);
+        }
+    } else {
+        auto it = std::lower_bound(container.array.begin(), container.array.end(), low);
+        if (it == container.array.end() || *it != low) {
+            return false;
+        }
+        container.array.erase(it);
+        container.cardinality--;
+    }
+    if (container.cardinality == 0) {
+        containers.erase(containers.begin() + position);
+    }
+    count--;
+    return true;
+}
+
+bool Bitmap::contains(std::uint32_t id) const {
+    std::uint16_t key = static_cast<std::uint16_t>(id >> 16);
+    std::uint16_t low = static_cast<std::uint16_t>(id & 0xFFFF);
+    size_t position = lowerBound(key);
+    if (position == containers.size() || containers[position].key != key) {
+        return false;
+    }
+    const Container& container = containers[position];
+    if (container.isBitset()) {
+        return (container.words[low >> 6] >> (low & 63)) & 1;
+    }
+    return std::binary_search(container.array.begin(), container.array.end(), low);
+}
+
+/**
+ * Walks both container lists in key order; only keys present in both
+ * can survive the AND
+ */
+void Bitmap::intersectWith(const Bitmap& other) {
+    std::vector<Container> kept;
+    size_t i = 0;
+    size_t j = 0;
+    count = 0;
+    while (i < containers.size() && j < other.containers.size()) {
+        if (containers[i].key < other.containers[j].key) {
+            ++i;
+        } else if (other.containers[j].key < containers[i].key) {
+            ++j;
+        } else {
+            Container result;
+            intersect(containers[i], other.containers[j], result);
+            if (result.cardinality > 0) {
+                count += result.cardinality;
+                kept.push_back(std::move(result));
+            }
+            ++i;
+            ++j;
+        }
+    }
+    containers.swap(kept);
+}
+
+void Bitmap::toVector(std::vector<std::uint32_t>& ids) const {
+    ids.reserve(ids.size() + count);
+    for (const Container& container : containers) {
+        std::uint32_t high = static_cast<std::uint32_t>(container.key) << 16;
+        if (container.isBitset()) {
+            for (size_t i = 0; i < BITSET_WORDS; ++i) {
+                std::uint64_t word = container.words[i];
+                while (word != 0) {
+                    ids.push_back(high | static_cast<std::uint32_t>((i << 6) + trailingZeros(word)));
+                    word &= word - 1;
+                }
+            }
+        } else {
+            for (std::uint16_t low : container.array) {
+                ids.push_back(high | low);
+            }
+        }
+    }
+}
+
+size_t Bitmap::cardinality() const {
+    return count;
+}
+
+bool Bitmap::isEmpty() const {
+    return count == 0;
+}
+
+void Bitmap::clear() {
+    containers.clear();
+    count = 0;
+}
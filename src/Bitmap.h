@@ -0,0 +1,136 @@
+/**
+ * @file Bitmap.h
+ * @brief Compressed bitmap of slot indices for SmallBiz Inventory System
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * This file defines Bitmap, a roaring-style compressed set of 32-bit ids.
+ * Inventory keeps one bitmap per value of each low-cardinality attribute
+ * (type, category, supplier, license), so a combined filter is a few
+ * bitmap intersections instead of a scan over every product.
+ */
+
+#ifndef BITMAP_H
+#define BITMAP_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class Bitmap
+ * @brief Set of uint32_t ids split into 65536-id containers
+ *
+ * Ids are grouped by their high 16 bits. Each non-empty group is stored
+ * as a sorted array of the low 16 bits while it holds at most 4096 ids
+ * (8 KB at most), and as a fixed 1024-word bitset (8 KB) above that.
+ * Sparse groups stay small and dense groups intersect word by word.
+ */
+class Bitmap {
+private:
+    /**
+     * @struct Container
+     * @brief The ids sharing one high 16-bit key
+     */
+    struct Container {
+        std::uint16_t key = 0;               ///< High 16 bits of every id here
+        std::uint32_t cardinality = 0;       ///< Number of ids stored
+        std::vector<std::uint16_t> array;    ///< Sorted low bits (array form)
+        std::vector<std::uint64_t> words;    ///< Bitset (bitset form), else empty
+
+        bool isBitset() const { return !words.empty(); }
+    };
+
+    /// Largest container kept in array form
+    static const std::uint32_t ARRAY_LIMIT = 4096;
+    /// 64-bit words in a bitset container (65536 bits)
+    static const size_t BITSET_WORDS = 1024;
+
+    std::vector<Container> containers;  ///< Non-empty containers sorted by key
+    size_t count;                       ///< Total number of ids
+
+    /**
+     * @brief Find the first container whose key is not less than key
+     * @param key High 16 bits to look for
+     * @return Position in containers (containers.size() if none)
+     */
+    size_t lowerBound(std::uint16_t key) const;
+
+    /**
+     * @brief Convert an array container to bitset form
+     * @param container Container to convert
+     */
+    static void toBitset(Container& container);
+
+    /**
+     * @brief Convert a bitset container to array form
+     * @param container Container to convert
+     */
+    static void toArray(Container& container);
+
+    /**
+     * @brief Intersect two containers with the same key
+     * @param a First container
+     * @param b Second container
+     * @param result Receives the intersection (may end up empty)
+     */
+    static void intersect(const Container& a, const Container& b, Container& result);
+
+public:
+    /**
+     * @brief Constructor - creates an empty bitmap
+     */
+    Bitmap();
+
+    /**
+     * @brief Add an id
+     * @param id Id to add
+     * @return true if added, false if it was already present
+     */
+    bool add(std::uint32_t id);
+
+    /**
+     * @brief Remove an id
+     * @param id Id to remove
+     * @return true if removed, false if it was not present
+     */
+    bool remove(std::uint32_t id);
+
+    /**
+     * @brief Check whether an id is present
+     * @param id Id to check
+     * @return true if present
+     */
+    bool contains(std::uint32_t id) const;
+
+    /**
+     * @brief Keep only the ids also present in another bitmap (AND)
+     * @param other Bitmap to intersect with
+     */
+    void intersectWith(const Bitmap& other);
+
+    /**
+     * @brief Append all ids in ascending order
+     * @param ids Receives the ids
+     */
+    void toVector(std::vector<std::uint32_t>& ids) const;
+
+    /**
+     * @brief Get the number of ids stored
+     * @return Cardinality
+     */
+    size_t cardinality() const;
+
+    /**
+     * @brief Check whether the bitmap holds no ids
+     * @return true if empty
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Remove all ids
+     */
+    void clear();
+};
+
+#endif // BITMAP_H
@@ -17,18 +17,18 @@
  * Default constructor - calls base class constructor
  */
 DigitalProduct::DigitalProduct() 
-    : Product(), downloadLink(""), fileSizeMB(0.0), licenseType("Single") {
-    setCategory("Digital");
+    : Product(ProductType::Digital), downloadLink(""), fileSizeMB(0.0), licenseType("Single") {
+    category = "Digital";
 }
 
 /**
  * Parameterized constructor with all digital product attributes
  */
 DigitalProduct::DigitalProduct(const std::string& sku, const std::string& name,
-                               double price, int quantity, const std::string& category,
+                               Money price, int quantity, const std::string& category,
                                const std::string& downloadLink, double fileSizeMB,
                                const std::string& licenseType)
-    : Product(sku, name, price, quantity, category), 
+    : Product(ProductType::Digital, sku, name, price, quantity, category), 
       downloadLink(downloadLink), licenseType(licenseType) {
     this->fileSizeMB = (fileSizeMB >= 0) ? fileSizeMB : 0.0;
 }
@@ -42,7 +42,7 @@ DigitalProduct::~DigitalProduct() {
 
 // ==================== GETTERS ====================
 
-std::string DigitalProduct::getDownloadLink() const {
+const std::string& DigitalProduct::getDownloadLink() const {
     return downloadLink;
 }
 
@@ -50,7 +50,7 @@ double DigitalProduct::getFileSizeMB() const {
     return fileSizeMB;
 }
 
-std::string DigitalProduct::getLicenseType() const {
+const std::string& DigitalProduct::getLicenseType() const {
     return licenseType;
 }
 
@@ -108,13 +108,13 @@ std::string DigitalProduct::getType() const {
  * Applies volume discount with bonus for digital products
  * Digital products get an extra 5% bonus on discounts (no shipping costs savings)
  */
-double DigitalProduct::applyDiscount(double percentage) const {
+Money DigitalProduct::applyDiscount(double percentage) const {
     if (percentage < 0 || percentage > 100) {
         return price;
     }
     // Digital products get a bonus 5% on discounts (capped at 50% total)
     double bonusPercentage = std::min(percentage + 5.0, 50.0);
-    return price * (1 - bonusPercentage / 100.0);
+    return price.percentOf(100.0 - bonusPercentage);
 }
 
 /**
@@ -131,20 +131,24 @@ std::string DigitalProduct::toCSV() const {
 /**
  * Factory method to create a DigitalProduct from CSV data
  * @param csvLine Format: Digital,sku,name,price,qty,category,link,size,license
- * @return New DigitalProduct pointer (caller responsible for deletion)
+ * @return New DigitalProduct pointer (caller responsible for deletion),
+ *         or nullptr if the price field is malformed
  */
 DigitalProduct* DigitalProduct::fromCSV(const std::string& csvLine) {
     std::stringstream ss(csvLine);
-    std::string type, sku, name, category, downloadLink, licenseType;
-    double price, fileSizeMB;
+    std::string type, sku, name, priceField, category, downloadLink, licenseType;
+    Money price;
+    double fileSizeMB;
     int quantity;
 
     // Parse CSV fields
     std::getline(ss, type, ',');      // "Digital"
     std::getline(ss, sku, ',');
     std::getline(ss, name, ',');
-    ss >> price;
-    ss.ignore(1);  // Skip comma
+    std::getline(ss, priceField, ',');
+    if (!Money::parse(priceField, price)) {
+        return nullptr;  // Malformed price - skip this record
+    }
     ss >> quantity;
     ss.ignore(1);
     std::getline(ss, category, ',');
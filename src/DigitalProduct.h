@@ -47,7 +47,7 @@ public:
      * @param licenseType Type of license
      */
     DigitalProduct(const std::string& sku, const std::string& name,
-                   double price, int quantity, const std::string& category,
+                   Money price, int quantity, const std::string& category,
                    const std::string& downloadLink, double fileSizeMB,
                    const std::string& licenseType);
 
@@ -60,9 +60,9 @@ public:
     
     /**
      * @brief Get the download link
-     * @return Download URL string
+     * @return Reference to the download URL
      */
-    std::string getDownloadLink() const;
+    const std::string& getDownloadLink() const;
 
     /**
      * @brief Get the file size
@@ -72,9 +72,9 @@ public:
 
     /**
      * @brief Get the license type
-     * @return License type string
+     * @return Reference to the license type
      */
-    std::string getLicenseType() const;
+    const std::string& getLicenseType() const;
 
     // ==================== SETTERS ====================
     
@@ -91,12 +91,17 @@ public:
      */
     bool setFileSizeMB(double size);
 
+private:
+    friend class Inventory;
+
     /**
      * @brief Set the license type
+     * Private: Inventory indexes license types (see Inventory::setLicenseType).
      * @param type New license type
      */
     void setLicenseType(const std::string& type);
 
+public:
     // ==================== OVERRIDDEN VIRTUAL FUNCTIONS ====================
     
     /**
@@ -117,7 +122,7 @@ public:
      * @param percentage Base discount percentage
      * @return Calculated discounted price with potential bonus
      */
-    double applyDiscount(double percentage) const override;
+    Money applyDiscount(double percentage) const override;
 
     /**
      * @brief Serialize to CSV format including digital attributes
@@ -128,7 +133,7 @@ public:
     /**
      * @brief Create a DigitalProduct from CSV data
      * @param csvLine Comma-separated product data
-     * @return Pointer to new DigitalProduct (caller owns memory)
+     * @return Pointer to new DigitalProduct (caller owns memory), or nullptr if malformed
      */
     static DigitalProduct* fromCSV(const std::string& csvLine);
 };
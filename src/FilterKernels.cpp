@@ -0,0 +1,272 @@
+/**
+ * @file FilterKernels.cpp
+ * @brief Implementation of the vectorized column filters
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * The AVX2 kernels are compiled with a per-function target attribute, so
+ * the rest of the program needs no -mavx2 and still runs on older CPUs.
+ * They build each 64-bit mask word in a register from eight compares and
+ * leave the final partial word to the scalar loop. Compilers without
+ * GCC-style target attributes (e.g. MSVC) always use the scalar kernels.
+ */
+
+#include "FilterKernels.h"
+#include <cstring>
+#include <limits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define FILTER_KERNELS_AVX2 1
+#include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// ==================== DISPATCH ====================
+
+static bool cpuHasAvx2() {
+#if defined(FILTER_KERNELS_AVX2)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+static bool& simdFiltersEnabled() {
+    static bool enabled = cpuHasAvx2();
+    return enabled;
+}
+
+bool setSimdFilters(bool enabled) {
+    simdFiltersEnabled() = enabled && cpuHasAvx2();
+    return simdFiltersEnabled();
+}
+
+/**
+ * A Scalar request overrides the process-wide choice for one call
+ */
+static bool useSimd(FilterKernel kernel) {
+    return kernel == FilterKernel::Selected && simdFiltersEnabled();
+}
+
+const char* filterKernelName() {
+    return simdFiltersEnabled() ? "AVX2" : "scalar";
+}
+
+// ==================== SCALAR KERNELS ====================
+
+static std::uint32_t popCount(std::uint64_t word) {
+#if defined(_MSC_VER)
+    return static_cast<std::uint32_t>(__popcnt64(word));
+#else
+    return static_cast<std::uint32_t>(__builtin_popcountll(word));
+#endif
+}
+
+/**
+ * Fills the mask words from row begin (a multiple of 64) to the end,
+ * one branch-free test per row
+ */
+template <typename Test>
+static void scalarSelect(std::size_t begin, std::size_t count, const std::uint8_t* live,
+                         std::uint64_t* mask, Test test) {
+    for (std::size_t word = begin / 64; word * 64 < count; ++word) {
+        std::uint64_t bits = 0;
+        std::size_t end = (word * 64 + 64 < count) ? word * 64 + 64 : count;
+        for (std::size_t i = word * 64; i < end; ++i) {
+            bits |= static_cast<std::uint64_t>((live[i] != 0) & test(i)) << (i & 63);
+        }
+        mask[word] = bits;
+    }
+}
+
+static std::size_t countSelected(const std::uint64_t* mask, std::size_t count) {
+    std::size_t selected = 0;
+    for (std::size_t word = 0; word < maskWords(count); ++word) {
+        selected += popCount(mask[word]);
+    }
+    return selected;
+}
+
+// Wrapping multiply, matching what the hot-column value sums compute
+static std::int64_t stockValue(std::int64_t price, std::int32_t quantity) {
+    return static_cast<std::int64_t>(static_cast<std::uint64_t>(price) *
+                                     static_cast<std::uint64_t>(quantity));
+}
+
+// ==================== AVX2 KERNELS ====================
+
+#if defined(FILTER_KERNELS_AVX2)
+
+/**
+ * Eight int32 rows per compare; a row is rejected if it is below low,
+ * above high or not live
+ */
+__attribute__((target("avx2")))
+static void selectRange32Avx2(const std::int32_t* values, const std::uint8_t* live, std::size_t words,
+                              std::int32_t low, std::int32_t high, std::uint64_t* mask) {
+    const __m256i lowVec = _mm256_set1_epi32(low);
+    const __m256i highVec = _mm256_set1_epi32(high);
+    const __m256i zero = _mm256_setzero_si256();
+    for (std::size_t word = 0; word < words; ++word) {
+        std::uint64_t bits = 0;
+        for (std::size_t lane = 0; lane < 64; lane += 8) {
+            std::size_t i = word * 64 + lane;
+            __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+            __m128i flags = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(live + i));
+            __m256i reject = _mm256_or_si256(
+                _mm256_or_si256(_mm256_cmpgt_epi32(lowVec, value), _mm256_cmpgt_epi32(value, highVec)),
+                _mm256_cmpeq_epi32(_mm256_cvtepu8_epi32(flags), zero));
+            std::uint32_t keep = ~static_cast<std::uint32_t>(
+                _mm256_movemask_ps(_mm256_castsi256_ps(reject))) & 0xFF;
+            bits |= static_cast<std::uint64_t>(keep) << lane;
+        }
+        mask[word] = bits;
+    }
+}
+
+/**
+ * Widens four live flags to 64-bit lanes; all ones where the flag is 0
+ */
+__attribute__((target("avx2")))
+static __m256i deadLanes64(const std::uint8_t* live) {
+    std::int32_t flags;
+    std::memcpy(&flags, live, sizeof(flags));
+    return _mm256_cmpeq_epi64(_mm256_cvtepu8_epi64(_mm_cvtsi32_si128(flags)), _mm256_setzero_si256());
+}
+
+__attribute__((target("avx2")))
+static void selectRange64Avx2(const std::int64_t* values, const std::uint8_t* live, std::size_t words,
+                              std::int64_t low, std::int64_t high, std::uint64_t* mask) {
+    const __m256i lowVec = _mm256_set1_epi64x(low);
+    const __m256i highVec = _mm256_set1_epi64x(high);
+    for (std::size_t word = 0; word < words; ++word) {
+        std::uint64_t bits = 0;
+        for (std::size_t lane = 0; lane < 64; lane += 4) {
+            std::size_t i = word * 64 + lane;
+            __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+            __m256i reject = _mm256_or_si256(
+                _mm256_or_si256(_mm256_cmpgt_epi64(lowVec, value), _mm256_cmpgt_epi64(value, highVec)),
+                deadLanes64(live + i));
+            std::uint32_t keep = ~static_cast<std::uint32_t>(
+                _mm256_movemask_pd(_mm256_castsi256_pd(reject))) & 0xF;
+            bits |= static_cast<std::uint64_t>(keep) << lane;
+        }
+        mask[word] = bits;
+    }
+}
+
+/**
+ * AVX2 has no 64-bit multiply, so price * quantity is built from two
+ * 32x32 products: lo(price) * q + (hi(price) * q << 32), which equals the
+ * low 64 bits of the full product for any non-negative quantity
+ */
+__attribute__((target("avx2")))
+static void selectValueAvx2(const std::int64_t* prices, const std::int32_t* quantities,
+                            const std::uint8_t* live, std::size_t words,
+                            std::int64_t minimum, std::uint64_t* mask) {
+    const __m256i minimumVec = _mm256_set1_epi64x(minimum);
+    for (std::size_t word = 0; word < words; ++word) {
+        std::uint64_t bits = 0;
+        for (std::size_t lane = 0; lane < 64; lane += 4) {
+            std::size_t i = word * 64 + lane;
+            __m256i price = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(prices + i));
+            __m256i quantity = _mm256_cvtepi32_epi64(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(quantities + i)));
+            __m256i low = _mm256_mul_epu32(price, quantity);
+            __m256i high = _mm256_mul_epu32(_mm256_srli_epi64(price, 32), quantity);
+            __m256i value = _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+            __m256i reject = _mm256_or_si256(_mm256_cmpgt_epi64(minimumVec, value), deadLanes64(live + i));
+            std::uint32_t keep = ~static_cast<std::uint32_t>(
+                _mm256_movemask_pd(_mm256_castsi256_pd(reject))) & 0xF;
+            bits |= static_cast<std::uint64_t>(keep) << lane;
+        }
+        mask[word] = bits;
+    }
+}
+
+#endif
+
+// ==================== PUBLIC INTERFACE ====================
+
+std::size_t maskWords(std::size_t count) {
+    return (count + 63) / 64;
+}
+
+std::size_t selectRange(const std::int32_t* values, const std::uint8_t* live, std::size_t count,
+                        std::int64_t low, std::int64_t high, std::uint64_t* mask,
+                        FilterKernel kernel) {
+    // Clamp the bounds to int32 so the vector compares cannot wrap
+    const std::int64_t minimum = std::numeric_limits<std::int32_t>::min();
+    const std::int64_t maximum = std::numeric_limits<std::int32_t>::max();
+    if (high < low || low > maximum || high < minimum) {
+        std::memset(mask, 0, maskWords(count) * sizeof(std::uint64_t));
+        return 0;
+    }
+    std::int32_t first = static_cast<std::int32_t>(low < minimum ? minimum : low);
+    std::int32_t last = static_cast<std::int32_t>(high > maximum ? maximum : high);
+
+    std::size_t done = 0;
+#if defined(FILTER_KERNELS_AVX2)
+    if (useSimd(kernel)) {
+        selectRange32Avx2(values, live, count / 64, first, last, mask);
+        done = count / 64 * 64;
+    }
+#endif
+    scalarSelect(done, count, live, mask, [=](std::size_t i) {
+        return values[i] >= first && values[i] <= last;
+    });
+    return countSelected(mask, count);
+}
+
+std::size_t selectRange(const std::int64_t* values, const std::uint8_t* live, std::size_t count,
+                        std::int64_t low, std::int64_t high, std::uint64_t* mask,
+                        FilterKernel kernel) {
+    std::size_t done = 0;
+#if defined(FILTER_KERNELS_AVX2)
+    if (useSimd(kernel)) {
+        selectRange64Avx2(values, live, count / 64, low, high, mask);
+        done = count / 64 * 64;
+    }
+#endif
+    scalarSelect(done, count, live, mask, [=](std::size_t i) {
+        return values[i] >= low && values[i] <= high;
+    });
+    return countSelected(mask, count);
+}
+
+std::size_t selectValueAtLeast(const std::int64_t* prices, const std::int32_t* quantities,
+                               const std::uint8_t* live, std::size_t count,
+                               std::int64_t minimum, std::uint64_t* mask,
+                               FilterKernel kernel) {
+    std::size_t done = 0;
+#if defined(FILTER_KERNELS_AVX2)
+    if (useSimd(kernel)) {
+        selectValueAvx2(prices, quantities, live, count / 64, minimum, mask);
+        done = count / 64 * 64;
+    }
+#endif
+    scalarSelect(done, count, live, mask, [=](std::size_t i) {
+        return stockValue(prices[i], quantities[i]) >= minimum;
+    });
+    return countSelected(mask, count);
+}
+
+void appendSelected(const std::uint64_t* mask, std::size_t count, std::vector<std::uint32_t>& indices) {
+    for (std::size_t word = 0; word < maskWords(count); ++word) {
+        std::uint64_t bits = mask[word];
+        while (bits != 0) {
+#if defined(_MSC_VER)
+            unsigned long bit;
+            _BitScanForward64(&bit, bits);
+#else
+            unsigned bit = static_cast<unsigned>(__builtin_ctzll(bits));
+#endif
+            indices.push_back(static_cast<std::uint32_t>(word * 64 + bit));
+            bits &= bits - 1;
+        }
+    }
+}
@@ -0,0 +1,108 @@
+/**
+ * @file FilterKernels.h
+ * @brief Vectorized column filters for SmallBiz Inventory System
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * Comparison kernels over the inventory's hot price and quantity columns.
+ * Each kernel tests a whole column and writes a selection bitmask with
+ * one bit per slot, so a numeric predicate costs a few instructions per
+ * eight rows instead of a branch per row. AVX2 versions are chosen at
+ * run time when the CPU supports them; otherwise portable scalar loops
+ * produce the same masks.
+ */
+
+#ifndef FILTERKERNELS_H
+#define FILTERKERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @enum FilterKernel
+ * @brief Which implementation a single kernel call runs
+ */
+enum class FilterKernel {
+    Selected,   ///< The kernels chosen by setSimdFilters (AVX2 when available)
+    Scalar      ///< The portable scalar loops, whatever is selected
+};
+
+/**
+ * @brief Number of 64-bit mask words needed for a column
+ * @param count Rows in the column
+ * @return Words in the selection mask
+ */
+std::size_t maskWords(std::size_t count);
+
+/**
+ * @brief Select live rows whose int32 value lies in [low, high]
+ * @param values Column values
+ * @param live Column of live flags (0 = skip the row)
+ * @param count Rows in the columns
+ * @param low Lowest value included
+ * @param high Highest value included
+ * @param mask Receives maskWords(count) words; bit i is set if row i matches
+ * @param kernel Implementation to run (e.g. Scalar to compare throughput)
+ * @return Number of rows selected
+ */
+std::size_t selectRange(const std::int32_t* values, const std::uint8_t* live, std::size_t count,
+                        std::int64_t low, std::int64_t high, std::uint64_t* mask,
+                        FilterKernel kernel = FilterKernel::Selected);
+
+/**
+ * @brief Select live rows whose int64 value lies in [low, high]
+ * @param values Column values
+ * @param live Column of live flags (0 = skip the row)
+ * @param count Rows in the columns
+ * @param low Lowest value included
+ * @param high Highest value included
+ * @param mask Receives maskWords(count) words; bit i is set if row i matches
+ * @param kernel Implementation to run (e.g. Scalar to compare throughput)
+ * @return Number of rows selected
+ */
+std::size_t selectRange(const std::int64_t* values, const std::uint8_t* live, std::size_t count,
+                        std::int64_t low, std::int64_t high, std::uint64_t* mask,
+                        FilterKernel kernel = FilterKernel::Selected);
+
+/**
+ * @brief Select live rows whose price * quantity is at least a minimum
+ * Quantities must be non-negative, as the inventory guarantees.
+ * @param prices Price column in cents
+ * @param quantities Quantity column
+ * @param live Column of live flags (0 = skip the row)
+ * @param count Rows in the columns
+ * @param minimum Smallest total value included, in cents
+ * @param mask Receives maskWords(count) words; bit i is set if row i matches
+ * @param kernel Implementation to run (e.g. Scalar to compare throughput)
+ * @return Number of rows selected
+ */
+std::size_t selectValueAtLeast(const std::int64_t* prices, const std::int32_t* quantities,
+                               const std::uint8_t* live, std::size_t count,
+                               std::int64_t minimum, std::uint64_t* mask,
+                               FilterKernel kernel = FilterKernel::Selected);
+
+/**
+ * @brief Append the positions of the set bits of a mask
+ * @param mask Selection mask
+ * @param count Rows covered by the mask
+ * @param indices Receives row numbers in ascending order
+ */
+void appendSelected(const std::uint64_t* mask, std::size_t count, std::vector<std::uint32_t>& indices);
+
+/**
+ * @brief Enable or disable the SIMD kernels for every later call
+ * Process-wide; to time the scalar kernels once, pass FilterKernel::Scalar
+ * to the kernel instead.
+ * @param enabled false forces the scalar kernels
+ * @return true if SIMD kernels are now in use
+ */
+bool setSimdFilters(bool enabled);
+
+/**
+ * @brief Get the name of the kernels currently in use
+ * @return "AVX2" or "scalar"
+ */
+const char* filterKernelName();
+
+#endif // FILTERKERNELS_H
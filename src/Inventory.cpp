@@ -10,9 +10,17 @@
  */
 
 #include "Inventory.h"
+#include "FilterKernels.h"
+#include "RadixSort.h"
+#include "ParallelSort.h"
+#include "StringUtils.h"
 #include <iostream>
 #include <sstream>
 #include <cctype>
+#include <chrono>
+#include <limits>
+#include <cmath>
+#include <iomanip>
 
 // ==================== CONSTRUCTOR & DESTRUCTOR ====================
 
@@ -35,293 +43,2136 @@ Inventory::~Inventory() {
 // ==================== PRIVATE HELPERS ====================
 
 /**
- * Rebuilds the SKU index map from the vector
- * Called after sorting to keep map references valid
+ * Records each slot's position in the (freshly sorted) display order
+ * O(n) and allocation-free; the SKU index is independent of order
  */
-void Inventory::rebuildIndex() {
-    skuIndex.clear();
-    for (Product* product : products) {
-        if (product != nullptr) {
-            skuIndex[product->getSku()] = product;
+void Inventory::refreshPositions() {
+    for (size_t i = 0; i < displayOrder.size(); ++i) {
+        slots[displayOrder[i]].position = static_cast<std::uint32_t>(i);
+    }
+}
+
+/**
+ * Stable in-place removal of REMOVED markers; refreshes slot positions
+ */
+void Inventory::compactDisplayOrder() {
+    if (removedCount == 0) {
+        return;
+    }
+    size_t out = 0;
+    for (std::uint32_t index : displayOrder) {
+        if (index != REMOVED) {
+            slots[index].position = static_cast<std::uint32_t>(out);
+            displayOrder[out++] = index;
+        }
+    }
+    displayOrder.resize(out);
+    removedCount = 0;
+    orderVersion++;
+}
+
+/**
+ * Places a product in a free slot, reusing freed slots first
+ */
+std::uint32_t Inventory::acquireSlot(Product* product) {
+    std::uint32_t index;
+    if (!freeSlots.empty()) {
+        index = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(slots.size());
+        slots.push_back(Slot());
+        priceColumn.push_back(0);
+        quantityColumn.push_back(0);
+        typeColumn.push_back(0);
+        liveColumn.push_back(0);
+    }
+    slots[index].product = product;
+    syncHotFields(index);
+    return index;
+}
+
+/**
+ * Frees a slot's product and bumps its generation so that
+ * any handle issued for the old product no longer resolves
+ */
+void Inventory::releaseSlot(std::uint32_t index) {
+    Slot& slot = slots[index];
+    delete slot.product;  // Free memory using delete
+    slot.product = nullptr;
+    slot.generation++;
+    // Zeroed hot fields make free slots contribute nothing to sums
+    priceColumn[index] = 0;
+    quantityColumn[index] = 0;
+    typeColumn[index] = 0;
+    liveColumn[index] = 0;
+    if (slot.generation == 0) {
+        slot.generation = 1;  // Generation 0 is reserved for null handles
+    }
+    freeSlots.push_back(index);
+}
+
+/**
+ * Builds a handle from a slot index and its current generation
+ */
+ProductHandle Inventory::handleFor(std::uint32_t index) const {
+    ProductHandle handle;
+    handle.index = index;
+    handle.generation = slots[index].generation;
+    return handle;
+}
+
+/**
+ * Mirrors price/quantity/type of a slot's product into the hot columns
+ */
+void Inventory::syncHotFields(std::uint32_t index) {
+    const Product* product = slots[index].product;
+    priceColumn[index] = product->getPrice().getCents();
+    quantityColumn[index] = product->getQuantity();
+    typeColumn[index] = static_cast<std::uint8_t>(product->getTypeTag());
+    liveColumn[index] = 1;
+}
+
+/**
+ * Removes a slot from one value's bitmap, dropping the value once empty
+ */
+static void eraseFromValueIndex(std::unordered_map<std::string, Bitmap>& valueIndex,
+                                const std::string& value, std::uint32_t index) {
+    auto it = valueIndex.find(toLowerCopy(value));
+    if (it != valueIndex.end()) {
+        it->second.remove(index);
+        if (it->second.isEmpty()) {
+            valueIndex.erase(it);
+        }
+    }
+}
+
+/**
+ * Registers a slot in the secondary indexes
+ */
+void Inventory::indexProduct(std::uint32_t index, unsigned fields) {
+    const Product* product = slots[index].product;
+    queryCache.invalidate(fields);
+    if (fields & FIELD_TYPE) {
+        typeIndex[static_cast<size_t>(product->getTypeTag())].add(index);
+    }
+    if (fields & FIELD_CATEGORY) {
+        categoryIndex[toLowerCopy(product->getCategory())].add(index);
+    }
+    // The type tag tells which subclass holds the supplier/license
+    if ((fields & FIELD_SUPPLIER) && product->getTypeTag() == ProductType::Physical) {
+        const auto* physical = static_cast<const PhysicalProduct*>(product);
+        supplierIndex[toLowerCopy(physical->getSupplier())].add(index);
+    }
+    if ((fields & FIELD_LICENSE) && product->getTypeTag() == ProductType::Digital) {
+        const auto* digital = static_cast<const DigitalProduct*>(product);
+        licenseIndex[toLowerCopy(digital->getLicenseType())].add(index);
+    }
+    // Keyed by supplier and quantity, so a change to either moves the entry
+    if ((fields & (FIELD_SUPPLIER | FIELD_QUANTITY)) && product->getTypeTag() == ProductType::Physical) {
+        const auto* physical = static_cast<const PhysicalProduct*>(product);
+        supplierStock[toLowerCopy(physical->getSupplier())].emplace(product->getQuantity(), index);
+    }
+    if (fields & FIELD_NAME) {
+        nameIndex.insert(index, product->getName());
+    }
+    if (fields & FIELD_SKU) {
+        skuOrder.emplace(product->getSku(), index);
+    }
+    if (fields & FIELD_QUANTITY) {
+        quantityOrder.emplace(product->getQuantity(), index);
+        quantityHistogram.add(product->getQuantity());
+    }
+    if (fields & FIELD_PRICE) {
+        priceOrder.emplace(product->getPrice().getCents(), index);
+        priceHistogram.add(product->getPrice().getCents());
+    }
+    patchSortViews(index, fields, true);
+}
+
+/**
+ * Unregisters a slot from the secondary indexes, dropping empty categories
+ */
+void Inventory::unindexProduct(std::uint32_t index, unsigned fields) {
+    const Product* product = slots[index].product;
+    queryCache.invalidate(fields);
+    patchSortViews(index, fields, false);
+    if (fields & FIELD_TYPE) {
+        typeIndex[static_cast<size_t>(product->getTypeTag())].remove(index);
+    }
+    if (fields & FIELD_CATEGORY) {
+        eraseFromValueIndex(categoryIndex, product->getCategory(), index);
+    }
+    if ((fields & FIELD_SUPPLIER) && product->getTypeTag() == ProductType::Physical) {
+        const auto* physical = static_cast<const PhysicalProduct*>(product);
+        eraseFromValueIndex(supplierIndex, physical->getSupplier(), index);
+    }
+    if ((fields & FIELD_LICENSE) && product->getTypeTag() == ProductType::Digital) {
+        const auto* digital = static_cast<const DigitalProduct*>(product);
+        eraseFromValueIndex(licenseIndex, digital->getLicenseType(), index);
+    }
+    if ((fields & (FIELD_SUPPLIER | FIELD_QUANTITY)) && product->getTypeTag() == ProductType::Physical) {
+        const auto* physical = static_cast<const PhysicalProduct*>(product);
+        auto it = supplierStock.find(toLowerCopy(physical->getSupplier()));
+        if (it != supplierStock.end()) {
+            it->second.erase(std::make_pair(product->getQuantity(), index));
+            if (it->second.empty()) {
+                supplierStock.erase(it);
+            }
+        }
+    }
+    if (fields & FIELD_NAME) {
+        nameIndex.remove(index, product->getName());
+    }
+    if (fields & FIELD_SKU) {
+        skuOrder.erase(product->getSku());
+    }
+    if (fields & FIELD_QUANTITY) {
+        quantityOrder.erase(std::make_pair(product->getQuantity(), index));
+        quantityHistogram.remove(product->getQuantity());
+    }
+    if (fields & FIELD_PRICE) {
+        priceOrder.erase(std::make_pair(product->getPrice().getCents(), index));
+        priceHistogram.remove(product->getPrice().getCents());
+    }
+}
+
+/**
+ * Index results come out in slot order; sort them back into display order
+ */
+std::vector<ProductHandle> Inventory::handlesInDisplayOrder(std::vector<std::uint32_t>& indices) const {
+    std::sort(indices.begin(), indices.end(),
+        [this](std::uint32_t a, std::uint32_t b) {
+            return slots[a].position < slots[b].position;
+        });
+    std::vector<ProductHandle> results;
+    results.reserve(indices.size());
+    for (std::uint32_t index : indices) {
+        results.push_back(handleFor(index));
+    }
+    return results;
+}
+
+// ==================== CRUD OPERATIONS ====================
+
+/**
+ * Adds a new product to inventory
+ * Takes ownership of the pointer - caller should not delete
+ */
+bool Inventory::addProduct(Product* product) {
+    if (product == nullptr) {
+        return false;
+    }
+    
+    // Check for duplicate SKU using the hash index (expected O(1))
+    if (skuIndex.contains(product->getSku())) {
+        return false;  // SKU already exists
+    }
+    
+    // Store in the slot map, then record display position and SKU
+    std::uint32_t index = acquireSlot(product);
+    slots[index].position = static_cast<std::uint32_t>(displayOrder.size());
+    displayOrder.push_back(index);
+    skuIndex.insert(product->getSku(), index);
+    indexProduct(index);
+    return true;
+}
+
+/**
+ * Removes a product by SKU and frees its memory
+ */
+bool Inventory::removeProduct(const std::string& sku) {
+    // Check if SKU exists using the hash index
+    std::uint32_t index;
+    if (!skuIndex.find(sku, index)) {
+        return false;  // Not found
+    }
+    
+    // Mark the tracked display position instead of searching and shifting;
+    // compact once markers outnumber live products (amortized O(1))
+    displayOrder[slots[index].position] = REMOVED;
+    removedCount++;
+    
+    // Remove from index before the SKU string it views is deleted,
+    // then free the slot (invalidates handles)
+    skuIndex.erase(sku);
+    unindexProduct(index);
+    releaseSlot(index);
+    if (removedCount * 2 > displayOrder.size()) {
+        compactDisplayOrder();
+    }
+    return true;
+}
+
+/**
+ * Updates product properties (non-empty/non-negative values only)
+ */
+bool Inventory::updateProduct(const std::string& sku, const std::string& name,
+                              Money price, int quantity) {
+    std::uint32_t index;
+    if (!skuIndex.find(sku, index)) {
+        return false;
+    }
+    Product* product = slots[index].product;
+    
+    // Update only if new values are provided
+    if (!name.empty()) {
+        unindexProduct(index, FIELD_NAME);
+        product->setName(name);
+        indexProduct(index, FIELD_NAME);
+    }
+    if (!price.isNegative()) {
+        unindexProduct(index, FIELD_PRICE);
+        product->setPrice(price);
+        indexProduct(index, FIELD_PRICE);
+    }
+    if (quantity >= 0) {
+        unindexProduct(index, FIELD_QUANTITY);
+        product->setQuantity(quantity);
+        indexProduct(index, FIELD_QUANTITY);
+    }
+    syncHotFields(index);
+    return true;
+}
+
+/**
+ * Sets the price, re-positioning the slot in the price index and
+ * refreshing the hot price column
+ */
+bool Inventory::setPrice(const std::string& sku, Money price) {
+    std::uint32_t index;
+    if (price.isNegative() || !skuIndex.find(sku, index)) {
+        return false;
+    }
+    unindexProduct(index, FIELD_PRICE);
+    slots[index].product->setPrice(price);
+    indexProduct(index, FIELD_PRICE);
+    priceColumn[index] = price.getCents();
+    return true;
+}
+
+/**
+ * Sets the quantity, re-positioning the slot in the quantity index and
+ * refreshing the hot quantity column
+ */
+bool Inventory::setQuantity(const std::string& sku, int quantity) {
+    std::uint32_t index;
+    if (quantity < 0 || !skuIndex.find(sku, index)) {
+        return false;
+    }
+    unindexProduct(index, FIELD_QUANTITY);
+    slots[index].product->setQuantity(quantity);
+    indexProduct(index, FIELD_QUANTITY);
+    quantityColumn[index] = quantity;
+    return true;
+}
+
+/**
+ * Moves a product between category index entries
+ */
+bool Inventory::setCategory(const std::string& sku, const std::string& category) {
+    std::uint32_t index;
+    if (!skuIndex.find(sku, index)) {
+        return false;
+    }
+    unindexProduct(index, FIELD_CATEGORY);
+    slots[index].product->setCategory(category);
+    indexProduct(index, FIELD_CATEGORY);
+    return true;
+}
+
+/**
+ * Moves a physical product between supplier bitmaps
+ */
+bool Inventory::setSupplier(const std::string& sku, const std::string& supplier) {
+    std::uint32_t index;
+    if (!skuIndex.find(sku, index) ||
+        slots[index].product->getTypeTag() != ProductType::Physical) {
+        return false;
+    }
+    unindexProduct(index, FIELD_SUPPLIER);
+    static_cast<PhysicalProduct*>(slots[index].product)->setSupplier(supplier);
+    indexProduct(index, FIELD_SUPPLIER);
+    return true;
+}
+
+/**
+ * Moves a digital product between license bitmaps
+ */
+bool Inventory::setLicenseType(const std::string& sku, const std::string& licenseType) {
+    std::uint32_t index;
+    if (!skuIndex.find(sku, index) ||
+        slots[index].product->getTypeTag() != ProductType::Digital) {
+        return false;
+    }
+    unindexProduct(index, FIELD_LICENSE);
+    static_cast<DigitalProduct*>(slots[index].product)->setLicenseType(licenseType);
+    indexProduct(index, FIELD_LICENSE);
+    return true;
+}
+
+/**
+ * Renames a product and re-indexes its name trigrams
+ */
+bool Inventory::setName(const std::string& sku, const std::string& name) {
+    std::uint32_t index;
+    if (!skuIndex.find(sku, index)) {
+        return false;
+    }
+    unindexProduct(index, FIELD_NAME);
+    slots[index].product->setName(name);
+    indexProduct(index, FIELD_NAME);
+    return true;
+}
+
+/**
+ * Retrieves a product by SKU using the hash index for fast lookup
+ */
+const Product* Inventory::getProduct(const std::string& sku) const {
+    std::uint32_t index;
+    if (skuIndex.find(sku, index)) {
+        return slots[index].product;
+    }
+    return nullptr;
+}
+
+// ==================== HANDLES ====================
+
+/**
+ * Looks up a SKU and returns a handle to its slot
+ */
+ProductHandle Inventory::findHandle(const std::string& sku) const {
+    std::uint32_t index;
+    if (skuIndex.find(sku, index)) {
+        return handleFor(index);
+    }
+    return ProductHandle();
+}
+
+/**
+ * Resolves a handle in O(1); stale handles (removed products) yield nullptr
+ */
+const Product* Inventory::resolve(ProductHandle handle) const {
+    if (handle.isNull() || handle.index >= slots.size()) {
+        return nullptr;
+    }
+    const Slot& slot = slots[handle.index];
+    if (slot.generation != handle.generation) {
+        return nullptr;
+    }
+    return slot.product;
+}
+
+/**
+ * Checks whether a handle still refers to a live product
+ */
+bool Inventory::isValid(ProductHandle handle) const {
+    return resolve(handle) != nullptr;
+}
+
+// ==================== VIEW & DISPLAY ====================
+
+/**
+ * Displays all products with formatted header
+ */
+void Inventory::displayAll() const {
+    if (isEmpty()) {
+        std::cout << "\n[!] Inventory is empty.\n";
+        return;
+    }
+    
+    std::cout << "\n";
+    Product::displayHeader();
+    
+    // Traverse live entries in display order
+    forEachInOrder([this](std::uint32_t index) {
+        slots[index].product->display();  // Polymorphic call
+    });
+    
+    std::cout << std::string(100, '-') << std::endl;
+    std::cout << "Total Products: " << getProductCount() 
+              << " | Total Value: $" << getTotalValue() << std::endl;
+}
+
+/**
+ * Displays summary statistics
+ */
+void Inventory::displaySummary() const {
+    size_t physicalCount = getCountByType(ProductType::Physical);
+    size_t digitalCount = getCountByType(ProductType::Digital);
+    
+    // Dense scan over the hot columns; free slots hold zeroes
+    std::int64_t valueByType[PRODUCT_TYPE_COUNT] = {0, 0};
+    for (size_t i = 0; i < slots.size(); ++i) {
+        valueByType[typeColumn[i]] += priceColumn[i] * quantityColumn[i];
+    }
+    Money physicalValue = Money::fromCents(valueByType[static_cast<size_t>(ProductType::Physical)]);
+    Money digitalValue = Money::fromCents(valueByType[static_cast<size_t>(ProductType::Digital)]);
+    
+    std::cout << "\n========== INVENTORY SUMMARY ==========\n";
+    std::cout << "Total Products: " << getProductCount() << std::endl;
+    std::cout << "  - Physical: " << physicalCount << " ($" 
+              << physicalValue << ")\n";
+    std::cout << "  - Digital:  " << digitalCount << " ($" 
+              << digitalValue << ")\n";
+    std::cout << "Total Inventory Value: $" << getTotalValue() << std::endl;
+    std::cout << "========================================\n";
+}
+
+/**
+ * Displays products below a stock threshold, lowest stock first
+ */
+void Inventory::displayLowStock(int threshold) const {
+    std::cout << "\n===== LOW STOCK ALERT (Below " << threshold << " units) =====\n";
+    
+    bool found = false;
+    Product::displayHeader();
+    
+    // The quantity index yields only the matching products
+    for (ProductHandle handle : findLowStock(threshold)) {
+        resolve(handle)->display();
+        found = true;
+    }
+    
+    if (!found) {
+        std::cout << "[OK] No products are below the stock threshold.\n";
+    }
+    std::cout << std::string(50, '=') << std::endl;
+}
+
+/**
+ * Displays each supplier's low-stock products with the weight to reorder
+ */
+void Inventory::displayReorderLists(int threshold) const {
+    // Formatted locally so std::cout keeps its own flags and precision
+    std::ostringstream out;
+    out << "\n===== SUPPLIER REORDER LISTS (Below " << threshold << " units) =====\n";
+
+    std::vector<ReorderList> lists = getReorderLists(threshold);
+    if (lists.empty()) {
+        out << "[OK] No physical products are below the stock threshold.\n";
+    }
+    out << std::fixed << std::setprecision(2);
+    for (const ReorderList& list : lists) {
+        out << "\nSupplier: " << list.supplier << "\n";
+        out << std::left << std::setw(12) << "SKU" << std::setw(10) << "In Stock"
+            << std::setw(10) << "Reorder" << "Weight (lbs)\n";
+        for (const ReorderLine& line : list.lines) {
+            out << std::setw(12) << line.sku << std::setw(10) << line.quantity
+                << std::setw(10) << line.reorderQuantity << line.weight << "\n";
+        }
+        out << "Total reorder weight: " << list.totalWeight << " lbs\n";
+    }
+    out << std::string(50, '=') << "\n";
+    std::cout << out.str() << std::flush;
+}
+
+/**
+ * Displays the highest-value products without reordering the inventory
+ */
+void Inventory::displayTopByValue(size_t k) const {
+    std::cout << "\n===== TOP " << k << " ITEMS BY VALUE =====\n";
+    if (isEmpty()) {
+        std::cout << "[!] Inventory is empty.\n";
+        return;
+    }
+
+    Product::displayHeader();
+    std::vector<ProductHandle> top = topByValue(k);
+    for (ProductHandle handle : top) {
+        resolve(handle)->display();
+    }
+    std::cout << std::string(100, '-') << std::endl;
+    std::cout << "Showing " << top.size() << " of " << getProductCount() << " products\n";
+}
+
+/**
+ * Compares the hot-column layout against walking the Product objects
+ * Each scan is repeated until it has run long enough to time reliably
+ */
+void Inventory::displayLayoutReport() const {
+    const size_t count = getProductCount();
+    const size_t hotBytes = sizeof(std::int64_t) + sizeof(std::int32_t) + 2 * sizeof(std::uint8_t);
+
+    std::cout << "\n========== STORAGE LAYOUT REPORT ==========\n";
+    std::cout << "Products: " << count << " (" << slots.size() << " slots)\n";
+    std::cout << "Hot columns:  " << hotBytes << " bytes/slot "
+              << "(price, quantity, type, live; " << CACHE_LINE_SIZE << "-byte aligned)\n";
+    std::cout << "Cold records: " << sizeof(PhysicalProduct) << " bytes/Physical, "
+              << sizeof(DigitalProduct) << " bytes/Digital (plus heap strings)\n";
+    std::cout << "Hot footprint: " << hotBytes * slots.size() << " bytes\n";
+
+    if (count == 0) {
+        std::cout << std::string(43, '=') << std::endl;
+        return;
+    }
+
+    // Runs scan repeatedly for at least ~20ms and returns rows per second
+    auto measure = [count](auto scan) {
+        using Clock = std::chrono::steady_clock;
+        volatile std::int64_t sink = 0;
+        size_t passes = 0;
+        Clock::time_point start = Clock::now();
+        Clock::duration elapsed;
+        do {
+            sink = sink + scan();
+            ++passes;
+            elapsed = Clock::now() - start;
+        } while (elapsed < std::chrono::milliseconds(20));
+        double seconds = std::chrono::duration<double>(elapsed).count();
+        return static_cast<double>(count * passes) / seconds;
+    };
+
+    const int threshold = 10;
+    double hotSummary = measure([this]() {
+        std::int64_t total = 0;
+        for (size_t i = 0; i < slots.size(); ++i) {
+            total += priceColumn[i] * quantityColumn[i];
+        }
+        return total;
+    });
+    double coldSummary = measure([this]() {
+        std::int64_t total = 0;
+        forEachInOrder([&](std::uint32_t index) {
+            total += slots[index].product->calculateValue().getCents();
+        });
+        return total;
+    });
+    double hotLowStock = measure([this, threshold]() {
+        std::int64_t matches = 0;
+        for (size_t i = 0; i < slots.size(); ++i) {
+            matches += (liveColumn[i] != 0 && quantityColumn[i] < threshold);
+        }
+        return matches;
+    });
+    double coldLowStock = measure([this, threshold]() {
+        std::int64_t matches = 0;
+        forEachInOrder([&](std::uint32_t index) {
+            matches += (slots[index].product->getQuantity() < threshold);
+        });
+        return matches;
+    });
+
+    // The same predicates through the filter kernels, mask included
+    std::vector<std::uint64_t> mask(maskWords(slots.size()));
+    const std::int64_t minimumValue = Money::fromCents(100000).getCents();
+    auto kernelLowStockScan = [this, threshold, &mask](FilterKernel kernel) {
+        return [this, threshold, &mask, kernel]() {
+            return static_cast<std::int64_t>(selectRange(quantityColumn.data(), liveColumn.data(), slots.size(),
+                                                         std::numeric_limits<int>::min(), threshold - 1,
+                                                         mask.data(), kernel));
+        };
+    };
+    auto kernelValueScan = [this, minimumValue, &mask](FilterKernel kernel) {
+        return [this, minimumValue, &mask, kernel]() {
+            return static_cast<std::int64_t>(selectValueAtLeast(priceColumn.data(), quantityColumn.data(),
+                                                                liveColumn.data(), slots.size(),
+                                                                minimumValue, mask.data(), kernel));
+        };
+    };
+    const std::string kernelName = filterKernelName();
+    double kernelLowStock = measure(kernelLowStockScan(FilterKernel::Selected));
+    double kernelValue = measure(kernelValueScan(FilterKernel::Selected));
+
+    // With AVX2 selected, time the portable kernels too; the process-wide
+    // setting is left alone
+    const bool compareScalar = kernelName != "scalar";
+    double scalarLowStock = 0.0;
+    double scalarValue = 0.0;
+    if (compareScalar) {
+        scalarLowStock = measure(kernelLowStockScan(FilterKernel::Scalar));
+        scalarValue = measure(kernelValueScan(FilterKernel::Scalar));
+    }
+    double hotValue = measure([this, minimumValue]() {
+        std::int64_t matches = 0;
+        for (size_t i = 0; i < slots.size(); ++i) {
+            matches += (liveColumn[i] != 0 && priceColumn[i] * quantityColumn[i] >= minimumValue);
+        }
+        return matches;
+    });
+    double coldValue = measure([this, minimumValue]() {
+        std::int64_t matches = 0;
+        forEachInOrder([&](std::uint32_t index) {
+            matches += (slots[index].product->calculateValue().getCents() >= minimumValue);
+        });
+        return matches;
+    });
+
+    // Formatted locally so std::cout keeps its own flags and precision
+    std::ostringstream out;
+    auto scalarCell = [compareScalar](double rate) {
+        std::ostringstream cell;
+        cell << std::fixed << std::setprecision(1);
+        if (compareScalar) {
+            cell << rate / 1e6;
+        } else {
+            cell << "-";
+        }
+        return cell.str();
+    };
+    out << "\nScan throughput (million rows/second, " << kernelName << " filter kernels):\n";
+    out << std::left << std::setw(22) << "Scan" << std::setw(10) << "Kernel" << std::setw(10) << "Scalar"
+        << std::setw(14) << "Hot columns" << "Product objects\n";
+    out << std::fixed << std::setprecision(1);
+    out << std::setw(22) << "Summary (value sum)" << std::setw(10) << "-" << std::setw(10) << "-"
+        << std::setw(14) << hotSummary / 1e6 << coldSummary / 1e6 << "\n";
+    out << std::setw(22) << "Low stock (qty < 10)" << std::setw(10) << kernelLowStock / 1e6
+        << std::setw(10) << scalarCell(scalarLowStock)
+        << std::setw(14) << hotLowStock / 1e6 << coldLowStock / 1e6 << "\n";
+    out << std::setw(22) << "Value >= $1000" << std::setw(10) << kernelValue / 1e6
+        << std::setw(10) << scalarCell(scalarValue)
+        << std::setw(14) << hotValue / 1e6 << coldValue / 1e6 << "\n";
+    out << std::string(43, '=') << "\n";
+    std::cout << out.str() << std::flush;
+}
+
+// ==================== SEARCH & FILTER ====================
+
+/**
+ * Searches products by name (case-insensitive partial match)
+ * The trigram index narrows the candidates, which are then verified
+ */
+std::vector<ProductHandle> Inventory::searchByName(const std::string& searchTerm) const {
+    // Matching ignores case, so terms differing only in case share an
+    // entry; the key views the term, so a hit only allocates the results
+    const QueryKey key{CACHE_NAME_SEARCH, searchTerm, true};
+    std::vector<ProductHandle> results;
+    if (queryCache.lookup(key, results)) {
+        return results;
+    }
+
+    std::vector<std::uint32_t> candidates;
+    if (nameIndex.candidates(searchTerm, candidates)) {
+        std::vector<std::uint32_t> matches;
+        for (std::uint32_t index : candidates) {
+            if (containsIgnoreCase(slots[index].product->getName(), searchTerm)) {
+                matches.push_back(index);
+            }
+        }
+        results = handlesInDisplayOrder(matches);
+    } else {
+        // Term too short for trigrams - scan names in place
+        forEachInOrder([&](std::uint32_t index) {
+            // Case-insensitive match in place - no lower-cased copies
+            if (containsIgnoreCase(slots[index].product->getName(), searchTerm)) {
+                results.push_back(handleFor(index));
+            }
+        });
+    }
+    queryCache.store(key, FIELD_NAME, results);
+    return results;
+}
+
+/**
+ * Filters products by category (partial match)
+ * Matches the query against each distinct category once, then gathers
+ * the members of the matching categories from the index
+ */
+std::vector<ProductHandle> Inventory::searchByCategory(const std::string& category) const {
+    const QueryKey key{CACHE_CATEGORY_SEARCH, category, true};
+    std::vector<ProductHandle> results;
+    if (queryCache.lookup(key, results)) {
+        return results;
+    }
+
+    std::vector<std::uint32_t> matches;
+    for (const auto& entry : categoryIndex) {
+        if (containsIgnoreCase(entry.first, category)) {
+            entry.second.toVector(matches);
+        }
+    }
+    results = handlesInDisplayOrder(matches);
+    queryCache.store(key, FIELD_CATEGORY, results);
+    return results;
+}
+
+/**
+ * Filters products by exact category with one hash lookup
+ */
+std::vector<ProductHandle> Inventory::searchByCategoryExact(const std::string& category) const {
+    std::vector<std::uint32_t> matches;
+    auto it = categoryIndex.find(toLowerCopy(category));
+    if (it != categoryIndex.end()) {
+        it->second.toVector(matches);
+    }
+    return handlesInDisplayOrder(matches);
+}
+
+/**
+ * Collects one bitmap per constrained attribute and ANDs them, smallest
+ * first so the running result only shrinks
+ */
+std::vector<ProductHandle> Inventory::filterByAttributes(const AttributeFilter& filter) const {
+    std::vector<const Bitmap*> bitmaps;
+    if (!filter.type.empty()) {
+        ProductType type;
+        if (!Product::parseType(filter.type, type)) {
+            return std::vector<ProductHandle>();  // Unknown type matches nothing
+        }
+        bitmaps.push_back(&typeIndex[static_cast<size_t>(type)]);
+    }
+
+    // A constrained value nobody has means no product can match
+    auto addValue = [&bitmaps](const std::unordered_map<std::string, Bitmap>& valueIndex,
+                               const std::string& value) {
+        if (value.empty()) {
+            return true;
+        }
+        auto it = valueIndex.find(toLowerCopy(value));
+        if (it == valueIndex.end()) {
+            return false;
+        }
+        bitmaps.push_back(&it->second);
+        return true;
+    };
+    if (!addValue(categoryIndex, filter.category) ||
+        !addValue(supplierIndex, filter.supplier) ||
+        !addValue(licenseIndex, filter.licenseType)) {
+        return std::vector<ProductHandle>();
+    }
+
+    std::vector<std::uint32_t> matches;
+    if (bitmaps.empty()) {
+        // No constraints: every product
+        forEachInOrder([&matches](std::uint32_t index) {
+            matches.push_back(index);
+        });
+        return handlesInDisplayOrder(matches);
+    }
+
+    std::sort(bitmaps.begin(), bitmaps.end(),
+        [](const Bitmap* a, const Bitmap* b) {
+            return a->cardinality() < b->cardinality();
+        });
+    Bitmap result = *bitmaps[0];
+    for (size_t i = 1; i < bitmaps.size() && !result.isEmpty(); ++i) {
+        result.intersectWith(*bitmaps[i]);
+    }
+    result.toVector(matches);
+    return handlesInDisplayOrder(matches);
+}
+
+/**
+ * Filters products by type (Physical/Digital)
+ */
+std::vector<ProductHandle> Inventory::searchByType(const std::string& type) const {
+    ProductType tag;
+    if (!Product::parseType(type, tag)) {
+        return std::vector<ProductHandle>();  // Unknown type matches nothing
+    }
+    return searchByType(tag);
+}
+
+/**
+ * Filters products by type tag (no string building per product)
+ */
+std::vector<ProductHandle> Inventory::searchByType(ProductType type) const {
+    std::vector<ProductHandle> results;
+    results.reserve(getCountByType(type));
+    forEachOfType(type, [&results](const Product*, ProductHandle handle) {
+        results.push_back(handle);
+    });
+    return results;
+}
+
+/**
+ * Walks the ordered SKU index from the first SKU >= prefix until the
+ * prefix stops matching
+ */
+std::vector<ProductHandle> Inventory::findBySkuPrefix(const std::string& prefix, size_t limit) const {
+    std::vector<ProductHandle> results;
+    for (auto it = skuOrder.lower_bound(prefix); it != skuOrder.end(); ++it) {
+        if (it->first.compare(0, prefix.size(), prefix) != 0) {
+            break;  // Past the last SKU with this prefix
+        }
+        if (limit != 0 && results.size() >= limit) {
+            break;
+        }
+        results.push_back(handleFor(it->second));
+    }
+    return results;
+}
+
+/**
+ * Returns all SKUs in the inclusive range [first, last]
+ */
+std::vector<ProductHandle> Inventory::findBySkuRange(const std::string& first, const std::string& last) const {
+    std::vector<ProductHandle> results;
+    if (last < first) {
+        return results;
+    }
+    auto end = skuOrder.upper_bound(last);
+    for (auto it = skuOrder.lower_bound(first); it != end; ++it) {
+        results.push_back(handleFor(it->second));
+    }
+    return results;
+}
+
+/**
+ * Lists up to limit SKUs beginning with prefix
+ */
+std::vector<std::string> Inventory::autocompleteSku(const std::string& prefix, size_t limit) const {
+    std::vector<std::string> suggestions;
+    for (auto it = skuOrder.lower_bound(prefix);
+         it != skuOrder.end() && suggestions.size() < limit; ++it) {
+        if (it->first.compare(0, prefix.size(), prefix) != 0) {
+            break;
+        }
+        suggestions.emplace_back(it->first);
+    }
+    return suggestions;
+}
+
+// Planner cost model, relative to testing one product during a full scan.
+// Index candidates are fetched out of display order (a random slot access)
+// and must be sorted back into display order; tree indexes add a pointer
+// chase per entry.
+static const double SCAN_ROW_COST = 1.0;
+static const double CANDIDATE_COST = 2.0;
+static const double TREE_CANDIDATE_COST = 3.0;
+static const double SORT_COST_FACTOR = 0.25;
+
+// A vectorized filter tests a slot of the hot columns for a small
+// fraction of the cost of testing a Product object
+static const double COLUMN_ROW_COST = 0.05;
+
+// Fraction assumed to match a name search too short for the trigram index
+static const double SHORT_NAME_SELECTIVITY = 0.25;
+
+// Fraction of a type assumed to match a weight, file size or download
+// link test, which no index or histogram covers
+static const double UNINDEXED_SELECTIVITY = 0.25;
+
+// SKU prefix estimates count at most this many index entries
+static const size_t SKU_PREFIX_PROBE_LIMIT = 1024;
+
+/**
+ * True if filtering the hot columns beats walking a tree index, whose
+ * extra cost per entry is the pointer chase
+ */
+static bool preferColumnScan(size_t slotCount, double matches) {
+    return slotCount * COLUMN_ROW_COST < matches * (TREE_CANDIDATE_COST - CANDIDATE_COST);
+}
+
+/**
+ * Walks the quantity index from the lowest quantity up to the threshold.
+ * When many products are low, filtering the quantity column is cheaper;
+ * the matches come out in slot order, so a stable counting sort by
+ * quantity gives the index's (quantity, slot) order.
+ */
+std::vector<ProductHandle> Inventory::findLowStock(int threshold) const {
+    std::vector<ProductHandle> results;
+    Query lowStock = Query::quantityBelow(threshold);
+    if (preferColumnScan(slots.size(), estimateRows(lowStock))) {
+        std::vector<std::uint32_t> indices;
+        columnCandidates(lowStock, indices);
+        if (indices.empty()) {
+            return results;
+        }
+        std::int32_t lowest = threshold;
+        for (std::uint32_t index : indices) {
+            lowest = std::min(lowest, quantityColumn[index]);
+        }
+        std::int64_t span = static_cast<std::int64_t>(threshold) - lowest;
+        results.resize(indices.size());
+        if (span <= static_cast<std::int64_t>(indices.size())) {
+            std::vector<size_t> starts(static_cast<size_t>(span) + 1, 0);
+            for (std::uint32_t index : indices) {
+                starts[quantityColumn[index] - lowest + 1]++;
+            }
+            for (size_t i = 1; i < starts.size(); ++i) {
+                starts[i] += starts[i - 1];
+            }
+            for (std::uint32_t index : indices) {
+                results[starts[quantityColumn[index] - lowest]++] = handleFor(index);
+            }
+        } else {
+            std::stable_sort(indices.begin(), indices.end(), [this](std::uint32_t a, std::uint32_t b) {
+                return quantityColumn[a] < quantityColumn[b];
+            });
+            for (size_t i = 0; i < indices.size(); ++i) {
+                results[i] = handleFor(indices[i]);
+            }
+        }
+        return results;
+    }
+
+    auto end = quantityOrder.lower_bound(std::make_pair(threshold, std::uint32_t(0)));
+    for (auto it = quantityOrder.begin(); it != end; ++it) {
+        results.push_back(handleFor(it->second));
+    }
+    return results;
+}
+
+/**
+ * Walks the price index between the two bounds
+ */
+std::vector<ProductHandle> Inventory::findByPriceRange(Money low, Money high) const {
+    std::vector<ProductHandle> results;
+    if (high < low) {
+        return results;
+    }
+    auto it = priceOrder.lower_bound(std::make_pair(low.getCents(), std::uint32_t(0)));
+    auto end = priceOrder.upper_bound(
+        std::make_pair(high.getCents(), std::numeric_limits<std::uint32_t>::max()));
+    for (; it != end; ++it) {
+        results.push_back(handleFor(it->second));
+    }
+    return results;
+}
+
+/**
+ * Filters the hot price and quantity columns with the value kernel; the
+ * selected count sizes the result before the mask is expanded
+ */
+std::vector<ProductHandle> Inventory::findByMinValue(Money minimum) const {
+    std::vector<std::uint64_t> mask(maskWords(slots.size()));
+    std::vector<std::uint32_t> indices;
+    indices.reserve(selectValueAtLeast(priceColumn.data(), quantityColumn.data(), liveColumn.data(),
+                                       slots.size(), minimum.getCents(), mask.data()));
+    appendSelected(mask.data(), slots.size(), indices);
+    return handlesInDisplayOrder(indices);
+}
+
+/**
+ * The heap's front is the weakest entry kept so far: lowest value, then
+ * latest display position. Later products only displace it with a
+ * strictly higher value, which keeps ties in display order.
+ */
+std::vector<ProductHandle> Inventory::topByValue(size_t k) const {
+    using Entry = std::pair<std::int64_t, size_t>;  // (value in cents, display position)
+    auto stronger = [](const Entry& a, const Entry& b) {
+        return a.first != b.first ? a.first > b.first : a.second < b.second;
+    };
+
+    std::vector<Entry> heap;
+    heap.reserve(std::min(k, getProductCount()));
+    for (size_t position = 0; position < displayOrder.size() && k > 0; ++position) {
+        std::uint32_t index = displayOrder[position];
+        if (index == REMOVED) {
+            continue;
+        }
+        Entry entry(priceColumn[index] * quantityColumn[index], position);
+        if (heap.size() < k) {
+            heap.push_back(entry);
+            std::push_heap(heap.begin(), heap.end(), stronger);
+        } else if (entry.first > heap.front().first) {
+            std::pop_heap(heap.begin(), heap.end(), stronger);
+            heap.back() = entry;
+            std::push_heap(heap.begin(), heap.end(), stronger);
+        }
+    }
+
+    std::sort_heap(heap.begin(), heap.end(), stronger);
+    std::vector<ProductHandle> results;
+    results.reserve(heap.size());
+    for (const Entry& entry : heap) {
+        results.push_back(handleFor(displayOrder[entry.second]));
+    }
+    return results;
+}
+
+/**
+ * Returns the cache's counters along with its current size and capacity
+ */
+QueryCacheStats Inventory::getQueryCacheStats() const {
+    return queryCache.getStats();
+}
+
+/**
+ * Resizes the search cache; shrinking evicts the least recently used entries
+ */
+void Inventory::setQueryCacheCapacity(size_t capacity) {
+    queryCache.setCapacity(capacity);
+}
+
+/**
+ * Starts a fresh measurement window without emptying the cache
+ */
+void Inventory::resetQueryCacheStats() {
+    queryCache.resetStats();
+}
+
+/**
+ * Prints the cache counters
+ * Formatted locally so std::cout keeps its own flags and precision
+ */
+void Inventory::displayQueryCacheStats() const {
+    QueryCacheStats stats = queryCache.getStats();
+    std::ostringstream out;
+    out << "\n========== SEARCH CACHE ==========\n";
+    out << "Cached searches: " << stats.entries << " / " << stats.capacity << "\n";
+    out << "Hits:   " << stats.hits << "\n";
+    out << "Misses: " << stats.misses << " (" << stats.stale << " invalidated by changes)\n";
+    out << "Evictions: " << stats.evictions << "\n";
+    out << "Hit rate: " << std::fixed << std::setprecision(1) << stats.hitRate() * 100.0 << "%\n";
+    out << std::string(34, '=') << "\n";
+    std::cout << out.str() << std::flush;
+}
+
+/**
+ * Gathers one leaf's candidates from the index named by planLeaf
+ */
+void Inventory::indexCandidates(const Query& leaf, std::vector<std::uint32_t>& indices) const {
+    indices.clear();
+    auto appendBitmap = [&indices](const std::unordered_map<std::string, Bitmap>& valueIndex,
+                                   const std::string& value) {
+        auto it = valueIndex.find(value);
+        if (it != valueIndex.end()) {
+            it->second.toVector(indices);
+        }
+    };
+
+    switch (leaf.kind()) {
+        case Query::Kind::SkuEquals: {
+            std::uint32_t index;
+            if (skuIndex.find(leaf.text(), index)) {
+                indices.push_back(index);
+            }
+            break;
+        }
+        case Query::Kind::SkuPrefix:
+            for (auto it = skuOrder.lower_bound(leaf.text()); it != skuOrder.end(); ++it) {
+                if (it->first.compare(0, leaf.text().size(), leaf.text()) != 0) {
+                    break;
+                }
+                indices.push_back(it->second);
+            }
+            break;
+        case Query::Kind::NameContains:
+            nameIndex.candidates(leaf.text(), indices);
+            break;
+        case Query::Kind::CategoryEquals:
+            appendBitmap(categoryIndex, leaf.text());
+            break;
+        case Query::Kind::CategoryContains:
+            for (const auto& entry : categoryIndex) {
+                if (containsIgnoreCase(entry.first, leaf.text())) {
+                    entry.second.toVector(indices);
+                }
+            }
+            break;
+        case Query::Kind::SupplierEquals:
+            appendBitmap(supplierIndex, leaf.text());
+            break;
+        case Query::Kind::LicenseEquals:
+            appendBitmap(licenseIndex, leaf.text());
+            break;
+        case Query::Kind::TypeIs:
+            typeIndex[static_cast<size_t>(leaf.productType())].toVector(indices);
+            break;
+        case Query::Kind::PriceRange: {
+            auto it = priceOrder.lower_bound(std::make_pair(leaf.low(), std::uint32_t(0)));
+            for (; it != priceOrder.end() && it->first <= leaf.high(); ++it) {
+                indices.push_back(it->second);
+            }
+            break;
+        }
+        case Query::Kind::QuantityRange: {
+            // Range bounds are int64; clamp to int before pairing with quantities,
+            // as selectRange does, so the cast cannot wrap
+            const std::int64_t minimum = std::numeric_limits<int>::min();
+            const std::int64_t maximum = std::numeric_limits<int>::max();
+            if (leaf.high() < leaf.low() || leaf.low() > maximum || leaf.high() < minimum) {
+                break;
+            }
+            int first = static_cast<int>(std::max(leaf.low(), minimum));
+            auto it = quantityOrder.lower_bound(std::make_pair(first, std::uint32_t(0)));
+            for (; it != quantityOrder.end() && it->first <= leaf.high(); ++it) {
+                indices.push_back(it->second);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void Inventory::columnCandidates(const Query& leaf, std::vector<std::uint32_t>& indices) const {
+    indices.clear();
+    std::vector<std::uint64_t> mask(maskWords(slots.size()));
+    size_t selected;
+    if (leaf.kind() == Query::Kind::PriceRange) {
+        selected = selectRange(priceColumn.data(), liveColumn.data(), slots.size(),
+                               leaf.low(), leaf.high(), mask.data());
+    } else if (leaf.kind() == Query::Kind::QuantityRange) {
+        selected = selectRange(quantityColumn.data(), liveColumn.data(), slots.size(),
+                               leaf.low(), leaf.high(), mask.data());
+    } else {
+        return;
+    }
+    indices.reserve(selected);
+    appendSelected(mask.data(), slots.size(), indices);
+}
+
+/**
+ * Leaf estimates come from the indexes themselves; combinations assume
+ * the predicates are independent
+ */
+double Inventory::estimateRows(const Query& query) const {
+    const double count = static_cast<double>(getProductCount());
+    if (count == 0.0) {
+        return 0.0;
+    }
+    auto bitmapSize = [](const std::unordered_map<std::string, Bitmap>& valueIndex,
+                         const std::string& value) {
+        auto it = valueIndex.find(value);
+        return it == valueIndex.end() ? 0.0 : static_cast<double>(it->second.cardinality());
+    };
+
+    switch (query.kind()) {
+        case Query::Kind::Everything:
+            return count;
+        case Query::Kind::SkuEquals:
+            return skuIndex.contains(query.text()) ? 1.0 : 0.0;
+        case Query::Kind::SkuPrefix: {
+            // Exact below the probe limit; beyond it, assume a tenth of the inventory
+            size_t matches = 0;
+            for (auto it = skuOrder.lower_bound(query.text());
+                 it != skuOrder.end() && matches < SKU_PREFIX_PROBE_LIMIT; ++it) {
+                if (it->first.compare(0, query.text().size(), query.text()) != 0) {
+                    break;
+                }
+                ++matches;
+            }
+            return matches < SKU_PREFIX_PROBE_LIMIT
+                ? static_cast<double>(matches)
+                : std::max(static_cast<double>(matches), count * 0.1);
+        }
+        case Query::Kind::NameContains: {
+            size_t candidates;
+            if (nameIndex.estimate(query.text(), candidates)) {
+                return std::min(count, static_cast<double>(candidates));
+            }
+            return query.text().empty() ? count : count * SHORT_NAME_SELECTIVITY;
+        }
+        case Query::Kind::CategoryEquals:
+            return bitmapSize(categoryIndex, query.text());
+        case Query::Kind::CategoryContains: {
+            double matches = 0.0;
+            for (const auto& entry : categoryIndex) {
+                if (containsIgnoreCase(entry.first, query.text())) {
+                    matches += static_cast<double>(entry.second.cardinality());
+                }
+            }
+            return matches;
         }
+        case Query::Kind::TypeIs:
+            return static_cast<double>(getCountByType(query.productType()));
+        case Query::Kind::PriceRange:
+            return priceHistogram.estimateRange(query.low(), query.high());
+        case Query::Kind::QuantityRange:
+            return quantityHistogram.estimateRange(query.low(), query.high());
+        case Query::Kind::SupplierEquals:
+            return bitmapSize(supplierIndex, query.text());
+        case Query::Kind::LicenseEquals:
+            return bitmapSize(licenseIndex, query.text());
+        case Query::Kind::WeightRange:
+            return static_cast<double>(getCountByType(ProductType::Physical)) * UNINDEXED_SELECTIVITY;
+        case Query::Kind::FileSizeRange:
+        case Query::Kind::DownloadLinkContains:
+            return static_cast<double>(getCountByType(ProductType::Digital)) * UNINDEXED_SELECTIVITY;
+        case Query::Kind::And: {
+            double fraction = 1.0;
+            for (const Query& child : query.children()) {
+                fraction *= estimateRows(child) / count;
+            }
+            return count * fraction;
+        }
+        case Query::Kind::Or: {
+            double missFraction = 1.0;
+            for (const Query& child : query.children()) {
+                missFraction *= 1.0 - estimateRows(child) / count;
+            }
+            return count * (1.0 - missFraction);
+        }
+        case Query::Kind::Not:
+            return count - estimateRows(query.children().front());
     }
+    return count;
 }
 
-// ==================== CRUD OPERATIONS ====================
+bool Inventory::planLeaf(const Query& leaf, QueryPlan& plan) const {
+    plan.driver = leaf;
+    switch (leaf.kind()) {
+        case Query::Kind::SkuEquals:
+            plan.access = AccessPath::SkuLookup;
+            break;
+        case Query::Kind::SkuPrefix:
+            plan.access = AccessPath::SkuRange;
+            break;
+        case Query::Kind::NameContains: {
+            size_t candidates;
+            if (!nameIndex.estimate(leaf.text(), candidates)) {
+                return false;  // Too short for trigrams
+            }
+            plan.access = AccessPath::NameIndex;
+            plan.estimatedCandidates = static_cast<double>(candidates);
+            return true;
+        }
+        case Query::Kind::CategoryEquals:
+        case Query::Kind::CategoryContains:
+        case Query::Kind::TypeIs:
+        case Query::Kind::SupplierEquals:
+        case Query::Kind::LicenseEquals:
+            plan.access = AccessPath::BitmapIndex;
+            break;
+        case Query::Kind::PriceRange:
+            plan.access = AccessPath::PriceIndex;
+            break;
+        case Query::Kind::QuantityRange:
+            plan.access = AccessPath::QuantityIndex;
+            break;
+        default:
+            return false;
+    }
+    // Apart from trigrams, an index yields exactly the leaf's matches
+    plan.estimatedCandidates = estimateRows(leaf);
+    return true;
+}
 
 /**
- * Adds a new product to inventory
- * Takes ownership of the pointer - caller should not delete
+ * A query can be driven by the whole query if it is an indexable leaf,
+ * or by any indexable operand of a top-level AND
  */
-bool Inventory::addProduct(Product* product) {
-    if (product == nullptr) {
-        return false;
+std::vector<QueryPlan> Inventory::considerPlans(const Query& query) const {
+    const double count = static_cast<double>(getProductCount());
+    const double rows = estimateRows(query);
+
+    std::vector<QueryPlan> plans;
+    QueryPlan scan;
+    scan.estimatedCandidates = count;
+    scan.estimatedRows = rows;
+    scan.estimatedCost = count * SCAN_ROW_COST;
+    plans.push_back(scan);
+
+    std::vector<Query> drivers;
+    if (query.kind() == Query::Kind::And) {
+        drivers = query.children();
+    } else {
+        drivers.push_back(query);
     }
-    
-    // Check for duplicate SKU using map for O(log n) lookup
-    if (skuIndex.find(product->getSku()) != skuIndex.end()) {
-        return false;  // SKU already exists
+    for (const Query& driver : drivers) {
+        QueryPlan plan;
+        if (!planLeaf(driver, plan)) {
+            continue;
+        }
+        bool tree = plan.access == AccessPath::SkuRange || plan.access == AccessPath::PriceIndex ||
+                    plan.access == AccessPath::QuantityIndex;
+        double candidates = plan.estimatedCandidates;
+        plan.estimatedRows = rows;
+        double sortCost = candidates * std::log2(candidates + 1.0) * SORT_COST_FACTOR;
+        plan.estimatedCost = candidates * (tree ? TREE_CANDIDATE_COST : CANDIDATE_COST) + sortCost;
+        plans.push_back(plan);
+
+        // Numeric ranges can also be answered by filtering the hot column
+        if (plan.access == AccessPath::PriceIndex || plan.access == AccessPath::QuantityIndex) {
+            plan.access = AccessPath::ColumnScan;
+            plan.estimatedCost = slots.size() * COLUMN_ROW_COST + candidates * CANDIDATE_COST + sortCost;
+            plans.push_back(plan);
+        }
     }
-    
-    // Add to both containers
-    products.push_back(product);
-    skuIndex[product->getSku()] = product;
-    return true;
+    return plans;
 }
 
 /**
- * Removes a product by SKU and frees its memory
+ * Position of the cheapest plan (the first one on ties)
  */
-bool Inventory::removeProduct(const std::string& sku) {
-    // Check if SKU exists using map
-    auto mapIt = skuIndex.find(sku);
-    if (mapIt == skuIndex.end()) {
-        return false;  // Not found
+static size_t cheapestPlan(const std::vector<QueryPlan>& plans) {
+    size_t best = 0;
+    for (size_t i = 1; i < plans.size(); ++i) {
+        if (plans[i].estimatedCost < plans[best].estimatedCost) {
+            best = i;
+        }
     }
-    
-    // Find and remove from vector
-    auto vecIt = std::find_if(products.begin(), products.end(),
-        [&sku](Product* p) { return p->getSku() == sku; });
-    
-    if (vecIt != products.end()) {
-        delete *vecIt;  // Free memory using delete
-        products.erase(vecIt);
+    return best;
+}
+
+QueryPlan Inventory::planQuery(const Query& query) const {
+    std::vector<QueryPlan> plans = considerPlans(query);
+    return plans[cheapestPlan(plans)];
+}
+
+std::string Inventory::explain(const Query& query) const {
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(0);
+    out << "Query: " << query.toString() << "\n";
+
+    std::vector<QueryPlan> plans = considerPlans(query);
+    const size_t best = cheapestPlan(plans);
+    const QueryPlan& chosen = plans[best];
+    out << "Plans considered (cost 1 = one product scanned, * = chosen):\n";
+    for (size_t i = 0; i < plans.size(); ++i) {
+        const QueryPlan& plan = plans[i];
+        out << (i == best ? "  * " : "    ") << accessPathName(plan.access);
+        if (plan.access != AccessPath::FullScan) {
+            out << " on " << plan.driver.toString();
+        }
+        out << ": ~" << plan.estimatedCandidates << " candidates, cost ~"
+            << plan.estimatedCost << "\n";
     }
-    
-    // Remove from map
-    skuIndex.erase(mapIt);
-    return true;
+
+    auto start = std::chrono::steady_clock::now();
+    QueryCursor cursor(*this, query, chosen);
+    size_t rows = 0;
+    ProductHandle handle;
+    while (cursor.next(handle)) {
+        rows++;
+    }
+    double elapsed = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+
+    out << "Estimated rows: " << chosen.estimatedRows << ", actual rows: " << rows << "\n";
+    out << "Examined " << cursor.getExamined() << " products in "
+        << std::setprecision(3) << elapsed << " ms\n";
+    return out.str();
 }
 
 /**
- * Updates product properties (non-empty/non-negative values only)
+ * Index candidates come out in index order; put them in display order
+ * so the cursor yields results in the same order as a scan
  */
-bool Inventory::updateProduct(const std::string& sku, const std::string& name,
-                              double price, int quantity) {
-    Product* product = getProduct(sku);
-    if (product == nullptr) {
-        return false;
+Inventory::QueryCursor::QueryCursor(const Inventory& inventory, const Query& query,
+                                    const QueryPlan& plan)
+    : inventory(&inventory), query(query), useCandidates(false), position(0),
+      plan(plan), examined(0) {
+    if (plan.access != AccessPath::FullScan) {
+        useCandidates = true;
+        if (plan.access == AccessPath::ColumnScan) {
+            inventory.columnCandidates(plan.driver, candidates);
+        } else {
+            inventory.indexCandidates(plan.driver, candidates);
+        }
+        std::sort(candidates.begin(), candidates.end(),
+            [&inventory](std::uint32_t a, std::uint32_t b) {
+                return inventory.slots[a].position < inventory.slots[b].position;
+            });
     }
-    
-    // Update only if new values are provided
-    if (!name.empty()) {
-        product->setName(name);
+}
+
+bool Inventory::QueryCursor::next(ProductHandle& handle) {
+    const std::vector<std::uint32_t>& order = useCandidates ? candidates : inventory->displayOrder;
+    while (position < order.size()) {
+        std::uint32_t index = order[position++];
+        if (index == REMOVED) {
+            continue;
+        }
+        examined++;
+        if (query.matches(*inventory->slots[index].product)) {
+            handle = inventory->handleFor(index);
+            return true;
+        }
     }
-    if (price >= 0) {
-        product->setPrice(price);
+    return false;
+}
+
+const QueryPlan& Inventory::QueryCursor::getPlan() const {
+    return plan;
+}
+
+size_t Inventory::QueryCursor::getExamined() const {
+    return examined;
+}
+
+Inventory::QueryCursor Inventory::query(const Query& query) const {
+    return QueryCursor(*this, query, planQuery(query));
+}
+
+std::vector<ProductHandle> Inventory::findAll(const Query& query) const {
+    std::vector<ProductHandle> results;
+    QueryCursor cursor = this->query(query);
+    ProductHandle handle;
+    while (cursor.next(handle)) {
+        results.push_back(handle);
     }
-    if (quantity >= 0) {
-        product->setQuantity(quantity);
+    return results;
+}
+
+/**
+ * Walks the supplier's stock set from the lowest quantity up to the
+ * threshold; each line orders enough units to bring stock back to it
+ */
+Inventory::ReorderList Inventory::getReorderList(const std::string& supplier, int threshold) const {
+    ReorderList list;
+    list.supplier = supplier;
+    auto stock = supplierStock.find(toLowerCopy(supplier));
+    if (stock == supplierStock.end()) {
+        return list;
     }
-    return true;
+
+    auto end = stock->second.lower_bound(std::make_pair(threshold, std::uint32_t(0)));
+    for (auto it = stock->second.begin(); it != end; ++it) {
+        const auto* product = static_cast<const PhysicalProduct*>(slots[it->second].product);
+        ReorderLine line;
+        line.handle = handleFor(it->second);
+        line.sku = product->getSku();
+        line.quantity = it->first;
+        line.reorderQuantity = threshold - it->first;
+        line.weight = line.reorderQuantity * product->getWeight();
+        list.totalWeight += line.weight;
+        list.lines.push_back(line);
+    }
+    if (!list.lines.empty()) {
+        // Report the supplier as spelled on the products
+        list.supplier = static_cast<const PhysicalProduct*>(resolve(list.lines.front().handle))->getSupplier();
+    }
+    return list;
 }
 
 /**
- * Retrieves a product by SKU using map for fast lookup
+ * Builds the list of every supplier that has something below threshold
  */
-Product* Inventory::getProduct(const std::string& sku) const {
-    auto it = skuIndex.find(sku);
-    if (it != skuIndex.end()) {
-        return it->second;
+std::vector<Inventory::ReorderList> Inventory::getReorderLists(int threshold) const {
+    std::vector<ReorderList> lists;
+    for (const auto& entry : supplierStock) {
+        // The first entry is the supplier's lowest stock
+        if (entry.second.begin()->first >= threshold) {
+            continue;
+        }
+        lists.push_back(getReorderList(entry.first, threshold));
     }
-    return nullptr;
+    std::sort(lists.begin(), lists.end(),
+        [](const ReorderList& a, const ReorderList& b) {
+            return a.supplier < b.supplier;
+        });
+    return lists;
 }
 
-// ==================== VIEW & DISPLAY ====================
+// ==================== PAGING ====================
 
 /**
- * Displays all products with formatted header
+ * A live product resumes from its current position. A removed one left
+ * a marker at its old position, which only holds while the order has
+ * not been rebuilt (the token records the order version).
  */
-void Inventory::displayAll() const {
-    if (products.empty()) {
-        std::cout << "\n[!] Inventory is empty.\n";
+bool Inventory::resumePosition(const std::string& token, size_t& start) const {
+    start = 0;
+    if (token.empty()) {
+        return true;
+    }
+    ProductHandle last;
+    std::uint64_t position = 0;
+    std::uint64_t version = 0;
+    char separators[3] = {0, 0, 0};
+    std::istringstream in(token);
+    in >> std::hex >> last.index >> separators[0] >> last.generation >> separators[1]
+       >> position >> separators[2] >> version;
+    if (in.fail() || !in.eof() || separators[0] != '.' || separators[1] != '.' ||
+        separators[2] != '.') {
+        return false;
+    }
+    if (isValid(last)) {
+        start = slots[last.index].position + 1;
+        return true;
+    }
+    if (version != orderVersion || position >= displayOrder.size()) {
+        return false;
+    }
+    start = static_cast<size_t>(position) + 1;
+    return true;
+}
+
+/**
+ * Token text is "index.generation.position.version" in hex
+ */
+std::string Inventory::pageToken(std::uint32_t index) const {
+    std::ostringstream out;
+    out << std::hex << index << '.' << slots[index].generation << '.'
+        << slots[index].position << '.' << orderVersion;
+    return out.str();
+}
+
+/**
+ * A page needs only limit + 1 matches. A scan finds them after about
+ * (limit + 1) / selectivity rows, while an index path still gathers every
+ * candidate, so small pages of common matches favour the scan
+ */
+QueryPlan Inventory::planPage(const Query& query, size_t limit) const {
+    QueryPlan plan = planQuery(query);
+    if (plan.access == AccessPath::FullScan || plan.estimatedRows <= 0.0) {
+        return plan;
+    }
+    const double count = static_cast<double>(getProductCount());
+    const double scanRows = std::min(count, (static_cast<double>(limit) + 1.0) * count / plan.estimatedRows);
+    if (scanRows * SCAN_ROW_COST < plan.estimatedCandidates * CANDIDATE_COST) {
+        QueryPlan scan;
+        scan.estimatedCandidates = scanRows;
+        scan.estimatedRows = plan.estimatedRows;
+        scan.estimatedCost = scanRows * SCAN_ROW_COST;
+        return scan;
+    }
+    return plan;
+}
+
+/**
+ * Only used uncached (no key, or the cache is disabled). Index candidates
+ * before the resume point are dropped in one pass. The first limit + 1 of
+ * the rest in display order (nth_element, then sort) usually fill the
+ * page; if verification rejects too many, the remainder is sorted once,
+ * so a sparse predicate costs O(c log c) like findAll.
+ */
+void Inventory::collectPage(const Query& query, const QueryPlan& plan, size_t limit, size_t start,
+                            std::vector<ProductHandle>& matches) const {
+    if (plan.access == AccessPath::FullScan) {
+        for (size_t i = start; i < displayOrder.size() && matches.size() <= limit; ++i) {
+            std::uint32_t index = displayOrder[i];
+            if (index != REMOVED && query.matches(*slots[index].product)) {
+                matches.push_back(handleFor(index));
+            }
+        }
         return;
     }
-    
-    std::cout << "\n";
-    Product::displayHeader();
-    
-    // Use iterator to traverse vector
-    for (const Product* product : products) {
-        product->display();  // Polymorphic call
+
+    std::vector<std::uint32_t> candidates;
+    if (plan.access == AccessPath::ColumnScan) {
+        columnCandidates(plan.driver, candidates);
+    } else {
+        indexCandidates(plan.driver, candidates);
+    }
+    candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+        [this, start](std::uint32_t index) {
+            return slots[index].position < start;
+        }), candidates.end());
+    auto byPosition = [this](std::uint32_t a, std::uint32_t b) {
+        return slots[a].position < slots[b].position;
+    };
+    size_t done = 0;
+    size_t batch = limit + 1;
+    while (matches.size() <= limit && done < candidates.size()) {
+        auto first = candidates.begin() + done;
+        auto last = candidates.begin() + std::min(candidates.size(), done + batch);
+        if (last != candidates.end()) {
+            std::nth_element(first, last, candidates.end(), byPosition);
+        }
+        std::sort(first, last, byPosition);
+        for (; first != last && matches.size() <= limit; ++first) {
+            if (query.matches(*slots[*first].product)) {
+                matches.push_back(handleFor(*first));
+            }
+        }
+        done += batch;
+        batch = candidates.size();
+    }
+}
+
+unsigned Inventory::queryFields(const Query& query) {
+    switch (query.kind()) {
+        case Query::Kind::SkuEquals:
+        case Query::Kind::SkuPrefix:
+            return FIELD_SKU;
+        case Query::Kind::NameContains:
+            return FIELD_NAME;
+        case Query::Kind::CategoryEquals:
+        case Query::Kind::CategoryContains:
+            return FIELD_CATEGORY;
+        case Query::Kind::TypeIs:
+            return FIELD_TYPE;
+        case Query::Kind::PriceRange:
+            return FIELD_PRICE;
+        case Query::Kind::QuantityRange:
+            return FIELD_QUANTITY;
+        case Query::Kind::SupplierEquals:
+            return FIELD_SUPPLIER;
+        case Query::Kind::LicenseEquals:
+            return FIELD_LICENSE;
+        case Query::Kind::And:
+        case Query::Kind::Or:
+        case Query::Kind::Not: {
+            unsigned fields = 0;
+            for (const Query& child : query.children()) {
+                fields |= queryFields(child);
+            }
+            return fields;
+        }
+        default:
+            // Everything, and fields Inventory cannot change once a product
+            // is added (weight, file size, download link)
+            return 0;
     }
-    
-    std::cout << std::string(100, '-') << std::endl;
-    std::cout << "Total Products: " << products.size() 
-              << " | Total Value: $" << std::fixed << std::setprecision(2) 
-              << getTotalValue() << std::endl;
 }
 
 /**
- * Displays summary statistics
+ * Fetches one extra match to learn whether another page follows. A keyed
+ * query's full result is cached once, not per page, so paging a large
+ * result takes one cache entry; positions in it ascend, so the resume
+ * point is a binary search.
  */
-void Inventory::displaySummary() const {
-    int physicalCount = 0, digitalCount = 0;
-    double physicalValue = 0, digitalValue = 0;
-    
-    for (const Product* product : products) {
-        if (product->getType() == "Physical") {
-            physicalCount++;
-            physicalValue += product->calculateValue();
-        } else {
-            digitalCount++;
-            digitalValue += product->calculateValue();
+bool Inventory::fetchPage(const Query& query, const QueryKey* key, unsigned fields, size_t limit,
+                          const std::string& token, std::vector<ProductHandle>& items,
+                          std::string& nextToken) const {
+    items.clear();
+    nextToken.clear();
+    size_t start;
+    if (limit == 0 || !resumePosition(token, start)) {
+        return false;
+    }
+
+    std::vector<ProductHandle> matches;
+    const std::vector<ProductHandle>* all = key != nullptr ? queryCache.find(*key) : nullptr;
+    if (all == nullptr) {
+        const QueryPlan plan = planPage(query, limit);
+        if (key != nullptr && plan.access != AccessPath::FullScan) {
+            std::vector<ProductHandle> results;
+            QueryCursor cursor(*this, query, plan);
+            ProductHandle handle;
+            while (cursor.next(handle)) {
+                results.push_back(handle);
+            }
+            all = queryCache.store(*key, fields, std::move(results));
+        }
+        if (all == nullptr) {
+            collectPage(query, plan, limit, start, matches);
         }
     }
-    
-    std::cout << "\n========== INVENTORY SUMMARY ==========\n";
-    std::cout << "Total Products: " << products.size() << std::endl;
-    std::cout << "  - Physical: " << physicalCount << " ($" 
-              << std::fixed << std::setprecision(2) << physicalValue << ")\n";
-    std::cout << "  - Digital:  " << digitalCount << " ($" 
-              << std::fixed << std::setprecision(2) << digitalValue << ")\n";
-    std::cout << "Total Inventory Value: $" 
-              << std::fixed << std::setprecision(2) << getTotalValue() << std::endl;
-    std::cout << "========================================\n";
+    if (all != nullptr) {
+        auto first = std::lower_bound(all->begin(), all->end(), start,
+            [this](ProductHandle handle, size_t position) {
+                return slots[handle.index].position < position;
+            });
+        auto last = first + static_cast<std::ptrdiff_t>(
+            std::min<size_t>(limit + 1, static_cast<size_t>(all->end() - first)));
+        matches.assign(first, last);
+    }
+    if (matches.size() > limit) {
+        matches.pop_back();
+        nextToken = pageToken(matches.back().index);
+    }
+    items = std::move(matches);
+    return true;
+}
+
+bool Inventory::listPage(size_t limit, const std::string& token, Page& page) const {
+    // Always a scan, which resumes in O(1)
+    return fetchPage(Query::everything(), nullptr, 0, limit, token, page.items, page.nextToken);
+}
+
+bool Inventory::queryPage(const Query& query, size_t limit, const std::string& token, Page& page) const {
+    const std::string text = query.toString();
+    const QueryKey key{CACHE_QUERY, text, false};
+    return fetchPage(query, &key, queryFields(query), limit, token, page.items, page.nextToken);
 }
 
 /**
- * Displays products below a stock threshold
+ * Shares searchByName's cache entry: both list the same matches in
+ * display order
  */
-void Inventory::displayLowStock(int threshold) const {
-    std::cout << "\n===== LOW STOCK ALERT (Below " << threshold << " units) =====\n";
-    
-    bool found = false;
-    Product::displayHeader();
-    
-    for (const Product* product : products) {
-        if (product->getQuantity() < threshold) {
-            product->display();
-            found = true;
+bool Inventory::searchByNamePage(const std::string& searchTerm, size_t limit, const std::string& token,
+                                 Page& page) const {
+    const QueryKey key{CACHE_NAME_SEARCH, searchTerm, true};
+    return fetchPage(Query::nameContains(searchTerm), &key, FIELD_NAME, limit, token,
+                     page.items, page.nextToken);
+}
+
+bool Inventory::searchByCategoryPage(const std::string& category, size_t limit, const std::string& token,
+                                     Page& page) const {
+    const QueryKey key{CACHE_CATEGORY_SEARCH, category, true};
+    return fetchPage(Query::categoryContains(category), &key, FIELD_CATEGORY, limit, token,
+                     page.items, page.nextToken);
+}
+
+// ==================== SORTING ====================
+
+// Numeric views of at least this many products are radix sorted; below
+// it the radix histograms cost about as much as std::sort's comparisons
+static const size_t RADIX_SORT_THRESHOLD = 32;
+
+// Comparison-sorted views of at least this many products are sorted on
+// several threads; smaller ones finish before threads pay for themselves
+static const size_t PARALLEL_SORT_THRESHOLD = 4 * PARALLEL_SORT_MIN_CHUNK;
+
+bool Inventory::sortLess(SortKey key, std::uint32_t ia, std::uint32_t ib) const {
+    const Product* a = slots[ia].product;
+    const Product* b = slots[ib].product;
+    switch (key) {
+        case SortKey::Sku:
+            return a->getSku() < b->getSku();  // SKUs are unique
+        case SortKey::Name: {
+            int order = a->getName().compare(b->getName());
+            if (order != 0) {
+                return order < 0;
+            }
+            break;
+        }
+        case SortKey::Price:
+            if (a->getPrice() != b->getPrice()) {
+                return a->getPrice() < b->getPrice();
+            }
+            break;
+        case SortKey::Quantity:
+            if (a->getQuantity() != b->getQuantity()) {
+                return a->getQuantity() < b->getQuantity();
+            }
+            break;
+        case SortKey::Value: {
+            Money valueA = a->calculateValue();
+            Money valueB = b->calculateValue();
+            if (valueA != valueB) {
+                return valueA > valueB;  // Highest value first
+            }
+            break;
+        }
+        case SortKey::Category: {
+            int order = a->getCategory().compare(b->getCategory());
+            if (order != 0) {
+                return order < 0;
+            }
+            break;
         }
     }
-    
-    if (!found) {
-        std::cout << "[OK] No products are below the stock threshold.\n";
+    return ia < ib;
+}
+
+/**
+ * Sorts the live slots once; afterwards patchSortViews keeps the view
+ * current (adds and removes are merged here on read), so it is only
+ * rebuilt after clearAll or when too many changes queue up.
+ * Numeric keys of large inventories are radix sorted from the hot
+ * columns. Slots are collected in ascending order and the radix sort is
+ * stable, so ties come out by slot index exactly as sortLess orders them.
+ */
+const std::vector<std::uint32_t>& Inventory::sortedView(SortKey key) const {
+    SortView& view = sortViews[static_cast<size_t>(key)];
+    if (view.valid) {
+        if (!view.pending.empty()) {
+            mergePendingSlots(key);
+        }
+        return view.order;
     }
-    std::cout << std::string(50, '=') << std::endl;
+
+    view.order.clear();
+    view.order.reserve(getProductCount());
+    bool numeric = key == SortKey::Price || key == SortKey::Quantity || key == SortKey::Value;
+    if (numeric && getProductCount() >= RADIX_SORT_THRESHOLD) {
+        std::vector<std::uint64_t> keys;
+        keys.reserve(getProductCount());
+        for (std::uint32_t index = 0; index < slots.size(); ++index) {
+            if (liveColumn[index] == 0) {
+                continue;
+            }
+            view.order.push_back(index);
+            if (key == SortKey::Price) {
+                keys.push_back(orderedKey(priceColumn[index]));
+            } else if (key == SortKey::Quantity) {
+                keys.push_back(orderedKey(quantityColumn[index]));
+            } else {
+                keys.push_back(~orderedKey(priceColumn[index] * quantityColumn[index]));  // Descending
+            }
+        }
+        radixSort(keys, view.order);
+    } else {
+        forEachInOrder([&view](std::uint32_t index) {
+            view.order.push_back(index);
+        });
+        // sortLess is a strict total order, so every thread count gives the same view
+        unsigned threads = getProductCount() >= PARALLEL_SORT_THRESHOLD ? getSortThreads() : 1;
+        parallelSort(view.order.begin(), view.order.end(),
+            [this, key](std::uint32_t a, std::uint32_t b) {
+                return sortLess(key, a, b);
+            }, threads);
+    }
+    view.valid = true;
+    return view.order;
 }
 
-// ==================== SEARCH & FILTER ====================
+/**
+ * An edit moves one slot: binary search finds its place in O(log n) and
+ * the vector insert/erase shifts the tail, a single memmove. Adds and
+ * removes would pay that shift every time, so they are queued instead;
+ * a view whose queue outgrows it is dropped and rebuilt on next use.
+ */
+void Inventory::patchSortViews(std::uint32_t index, unsigned fields, bool insert) {
+    // IndexedField flags each view's key depends on, in SortKey order
+    static const unsigned keyFields[SORT_KEY_COUNT] = {
+        FIELD_SKU, FIELD_NAME, FIELD_PRICE, FIELD_QUANTITY, FIELD_PRICE | FIELD_QUANTITY, FIELD_CATEGORY
+    };
+    for (size_t k = 0; k < SORT_KEY_COUNT; ++k) {
+        SortView& view = sortViews[k];
+        if (!view.valid || !(fields & keyFields[k])) {
+            continue;
+        }
+        // Entries of queued slots may be stale, so binary search is only
+        // safe while nothing is queued
+        if (fields == ALL_FIELDS || !view.pending.empty()) {
+            view.pending.push_back(index);
+            if (view.pending.size() > view.order.size()) {
+                view.order.clear();
+                view.pending.clear();
+                view.valid = false;
+            }
+            continue;
+        }
+        SortKey key = static_cast<SortKey>(k);
+        auto it = std::lower_bound(view.order.begin(), view.order.end(), index,
+            [this, key](std::uint32_t a, std::uint32_t b) {
+                return sortLess(key, a, b);
+            });
+        if (insert) {
+            view.order.insert(it, index);
+        } else if (it != view.order.end() && *it == index) {
+            view.order.erase(it);
+        }
+    }
+}
 
 /**
- * Searches products by name (case-insensitive partial match)
+ * A slot may be queued several times (removed, reused, edited), so
+ * entries are dropped and re-added by slot index: whatever the slot
+ * holds now is merged back in once
  */
-std::vector<Product*> Inventory::searchByName(const std::string& searchTerm) const {
-    std::vector<Product*> results;
-    
-    // Convert search term to lowercase for case-insensitive search
-    std::string lowerSearch = searchTerm;
-    std::transform(lowerSearch.begin(), lowerSearch.end(), lowerSearch.begin(), ::tolower);
-    
-    for (Product* product : products) {
-        std::string lowerName = product->getName();
-        std::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), ::tolower);
-        
-        // Check if search term is found in name
-        if (lowerName.find(lowerSearch) != std::string::npos) {
-            results.push_back(product);
+void Inventory::mergePendingSlots(SortKey key) const {
+    SortView& view = sortViews[static_cast<size_t>(key)];
+    std::vector<std::uint8_t> queued(slots.size(), 0);
+    for (std::uint32_t index : view.pending) {
+        queued[index] = 1;
+    }
+    view.order.erase(std::remove_if(view.order.begin(), view.order.end(),
+        [&queued](std::uint32_t index) {
+            return queued[index] != 0;
+        }), view.order.end());
+
+    const size_t merged = view.order.size();
+    for (std::uint32_t index : view.pending) {
+        if (queued[index] != 0) {
+            queued[index] = 0;
+            if (slots[index].product != nullptr) {
+                view.order.push_back(index);
+            }
         }
     }
+    view.pending.clear();
+    auto less = [this, key](std::uint32_t a, std::uint32_t b) {
+        return sortLess(key, a, b);
+    };
+    std::sort(view.order.begin() + merged, view.order.end(), less);
+    std::inplace_merge(view.order.begin(), view.order.begin() + merged, view.order.end(), less);
+}
+
+void Inventory::sortBy(SortKey key) {
+    displayOrder = sortedView(key);
+    removedCount = 0;
+    refreshPositions();
+    // Cached search results are listed in display order
+    queryCache.invalidate(ALL_FIELDS);
+    orderVersion++;
+}
+
+void Inventory::setSortThreads(unsigned threads) {
+    sortThreads = threads;
+}
+
+unsigned Inventory::getSortThreads() const {
+    if (sortThreads != 0) {
+        return sortThreads;
+    }
+    unsigned cores = std::thread::hardware_concurrency();
+    return cores == 0 ? 1 : cores;  // 0 means the count is unknown
+}
+
+std::vector<ProductHandle> Inventory::getSortedView(SortKey key) const {
+    const std::vector<std::uint32_t>& order = sortedView(key);
+    std::vector<ProductHandle> results;
+    results.reserve(order.size());
+    for (std::uint32_t index : order) {
+        results.push_back(handleFor(index));
+    }
     return results;
 }
 
 /**
- * Filters products by category
+ * SKU ranks come straight from the ordered SKU index. Names and
+ * categories repeat, so only their distinct values are sorted.
  */
-std::vector<Product*> Inventory::searchByCategory(const std::string& category) const {
-    std::vector<Product*> results;
-    
-    std::string lowerCategory = category;
-    std::transform(lowerCategory.begin(), lowerCategory.end(), lowerCategory.begin(), ::tolower);
-    
-    for (Product* product : products) {
-        std::string lowerProdCat = product->getCategory();
-        std::transform(lowerProdCat.begin(), lowerProdCat.end(), lowerProdCat.begin(), ::tolower);
-        
-        if (lowerProdCat.find(lowerCategory) != std::string::npos) {
-            results.push_back(product);
+void Inventory::rankSlots(SortKey key, std::vector<std::uint64_t>& ranks) const {
+    ranks.assign(slots.size(), 0);
+    if (key == SortKey::Sku) {
+        std::uint64_t rank = 0;
+        for (const auto& entry : skuOrder) {
+            ranks[entry.second] = rank++;
         }
+        return;
     }
-    return results;
+
+    auto text = [this, key](std::uint32_t index) -> std::string_view {
+        const Product* product = slots[index].product;
+        return key == SortKey::Name ? product->getName() : product->getCategory();
+    };
+    std::unordered_map<std::string_view, std::uint64_t> rankOf;
+    forEachInOrder([&](std::uint32_t index) {
+        rankOf.emplace(text(index), 0);
+    });
+    std::vector<std::string_view> values;
+    values.reserve(rankOf.size());
+    for (const auto& entry : rankOf) {
+        values.push_back(entry.first);
+    }
+    std::sort(values.begin(), values.end());
+    for (size_t i = 0; i < values.size(); ++i) {
+        rankOf[values[i]] = i;
+    }
+    forEachInOrder([&](std::uint32_t index) {
+        ranks[index] = rankOf[text(index)];
+    });
 }
 
 /**
- * Filters products by type (Physical/Digital)
+ * Compiles the spec into one row of integer keys per product, taken in
+ * display order, then orders the rows lexicographically with the row
+ * number breaking full ties, which makes the sort stable. Small
+ * inventories use one comparator over the rows; large ones radix sort
+ * the key columns instead.
  */
-std::vector<Product*> Inventory::searchByType(const std::string& type) const {
-    std::vector<Product*> results;
-    
-    std::string lowerType = type;
-    std::transform(lowerType.begin(), lowerType.end(), lowerType.begin(), ::tolower);
-    
-    for (Product* product : products) {
-        std::string lowerProdType = product->getType();
-        std::transform(lowerProdType.begin(), lowerProdType.end(), lowerProdType.begin(), ::tolower);
-        
-        if (lowerProdType == lowerType) {
-            results.push_back(product);
+std::vector<std::uint32_t> Inventory::sortedSlots(const SortSpec& spec) const {
+    std::vector<std::uint32_t> order;
+    order.reserve(getProductCount());
+    forEachInOrder([&order](std::uint32_t index) {
+        order.push_back(index);
+    });
+    const std::vector<SortSpec::Term>& terms = spec.getTerms();
+    const size_t width = terms.size();
+    const size_t count = order.size();
+    if (width == 0) {
+        return order;
+    }
+
+    std::vector<std::uint64_t> rows(count * width);
+    std::vector<std::uint64_t> ranks;
+    for (size_t term = 0; term < width; ++term) {
+        const SortKey key = terms[term].key;
+        if (key == SortKey::Sku || key == SortKey::Name || key == SortKey::Category) {
+            rankSlots(key, ranks);
+        }
+        const bool descending = terms[term].order == SortOrder::Descending;
+        for (size_t row = 0; row < count; ++row) {
+            std::uint32_t index = order[row];
+            std::uint64_t value;
+            if (key == SortKey::Price) {
+                value = orderedKey(priceColumn[index]);
+            } else if (key == SortKey::Quantity) {
+                value = orderedKey(quantityColumn[index]);
+            } else if (key == SortKey::Value) {
+                value = orderedKey(priceColumn[index] * quantityColumn[index]);
+            } else {
+                value = ranks[index];
+            }
+            rows[row * width + term] = descending ? ~value : value;
         }
     }
+
+    std::vector<std::uint32_t> rowOrder(count);
+    for (size_t row = 0; row < count; ++row) {
+        rowOrder[row] = static_cast<std::uint32_t>(row);
+    }
+    if (count >= RADIX_SORT_THRESHOLD) {
+        // Same order without comparisons: stable radix passes from the
+        // least significant key up, starting from display order
+        std::vector<std::uint64_t> keys(count);
+        for (size_t term = width; term-- > 0;) {
+            for (size_t i = 0; i < count; ++i) {
+                keys[i] = rows[rowOrder[i] * width + term];
+            }
+            radixSort(keys, rowOrder);
+        }
+    } else {
+        std::sort(rowOrder.begin(), rowOrder.end(),
+            [&rows, width](std::uint32_t a, std::uint32_t b) {
+                const std::uint64_t* rowA = &rows[a * width];
+                const std::uint64_t* rowB = &rows[b * width];
+                for (size_t term = 0; term < width; ++term) {
+                    if (rowA[term] != rowB[term]) {
+                        return rowA[term] < rowB[term];
+                    }
+                }
+                return a < b;
+            });
+    }
+
+    std::vector<std::uint32_t> sorted(count);
+    for (size_t i = 0; i < count; ++i) {
+        sorted[i] = order[rowOrder[i]];
+    }
+    return sorted;
+}
+
+std::vector<ProductHandle> Inventory::getSorted(const SortSpec& spec) const {
+    std::vector<std::uint32_t> order = sortedSlots(spec);
+    std::vector<ProductHandle> results;
+    results.reserve(order.size());
+    for (std::uint32_t index : order) {
+        results.push_back(handleFor(index));
+    }
     return results;
 }
 
-// ==================== SORTING ====================
+void Inventory::displaySlots(const std::string& title, const std::vector<std::uint32_t>& order) const {
+    if (isEmpty()) {
+        std::cout << "\n[!] Inventory is empty.\n";
+        return;
+    }
+
+    std::cout << "\n" << title << "\n";
+    Product::displayHeader();
+    for (std::uint32_t index : order) {
+        slots[index].product->display();
+    }
+
+    std::cout << std::string(100, '-') << std::endl;
+    std::cout << "Total Products: " << getProductCount()
+              << " | Total Value: $" << getTotalValue() << std::endl;
+}
+
+/**
+ * Displays products in view order; the display order is left alone
+ */
+void Inventory::displaySorted(SortKey key) const {
+    displaySlots(std::string("Sorted by ") + sortKeyName(key) + ":", sortedView(key));
+}
+
+void Inventory::displaySorted(const SortSpec& spec) const {
+    displaySlots("Sorted by " + spec.toString() + ":", sortedSlots(spec));
+}
+
+void Inventory::sortBy(const SortSpec& spec) {
+    displayOrder = sortedSlots(spec);
+    removedCount = 0;
+    refreshPositions();
+    // Cached search results are listed in display order
+    queryCache.invalidate(ALL_FIELDS);
+    orderVersion++;
+}
 
 /**
  * Sorts products by SKU alphabetically
- * Uses std::sort with lambda comparator
  */
 void Inventory::sortBySku() {
-    std::sort(products.begin(), products.end(),
-        [](Product* a, Product* b) {
-            return a->getSku() < b->getSku();
-        });
-    rebuildIndex();
+    sortBy(SortKey::Sku);
 }
 
 /**
  * Sorts products by name alphabetically
  */
 void Inventory::sortByName() {
-    std::sort(products.begin(), products.end(),
-        [](Product* a, Product* b) {
-            return a->getName() < b->getName();
-        });
-    rebuildIndex();
+    sortBy(SortKey::Name);
 }
 
 /**
  * Sorts products by price (ascending)
  */
 void Inventory::sortByPrice() {
-    std::sort(products.begin(), products.end(),
-        [](Product* a, Product* b) {
-            return a->getPrice() < b->getPrice();
-        });
-    rebuildIndex();
+    sortBy(SortKey::Price);
 }
 
 /**
  * Sorts products by quantity (ascending)
  */
 void Inventory::sortByQuantity() {
-    std::sort(products.begin(), products.end(),
-        [](Product* a, Product* b) {
-            return a->getQuantity() < b->getQuantity();
-        });
-    rebuildIndex();
+    sortBy(SortKey::Quantity);
 }
 
 /**
  * Sorts products by total value (descending - highest first)
  */
 void Inventory::sortByValue() {
-    std::sort(products.begin(), products.end(),
-        [](Product* a, Product* b) {
-            return a->calculateValue() > b->calculateValue();
-        });
-    rebuildIndex();
+    sortBy(SortKey::Value);
 }
 
 // ==================== FILE I/O ====================
@@ -342,9 +2193,9 @@ bool Inventory::saveToFile() const {
     file << "# Format: Type,SKU,Name,Price,Quantity,Category,[Type-specific fields]\n";
     
     // Write each product's CSV representation
-    for (const Product* product : products) {
-        file << product->toCSV() << "\n";
-    }
+    forEachInOrder([&](std::uint32_t index) {
+        file << slots[index].product->toCSV() << "\n";
+    });
     
     file.close();
     return true;
@@ -405,32 +2256,41 @@ void Inventory::setDataFilePath(const std::string& path) {
  * Returns the number of products
  */
 size_t Inventory::getProductCount() const {
-    return products.size();
+    return displayOrder.size() - removedCount;
+}
+
+/**
+ * Returns the per-type product count kept by add/remove
+ */
+size_t Inventory::getCountByType(ProductType type) const {
+    return typeIndex[static_cast<size_t>(type)].cardinality();
 }
 
 /**
  * Calculates total inventory value
+ * Integer cents make the sum exact regardless of order
  */
-double Inventory::getTotalValue() const {
-    double total = 0.0;
-    for (const Product* product : products) {
-        total += product->calculateValue();
+Money Inventory::getTotalValue() const {
+    // Dense scan over the hot columns; free slots hold zeroes
+    std::int64_t total = 0;
+    for (size_t i = 0; i < slots.size(); ++i) {
+        total += priceColumn[i] * quantityColumn[i];
     }
-    return total;
+    return Money::fromCents(total);
 }
 
 /**
  * Checks if inventory is empty
  */
 bool Inventory::isEmpty() const {
-    return products.empty();
+    return getProductCount() == 0;
 }
 
 /**
- * Checks if a SKU exists (O(log n) using map)
+ * Checks if a SKU exists (expected O(1) using the hash index)
  */
 bool Inventory::skuExists(const std::string& sku) const {
-    return skuIndex.find(sku) != skuIndex.end();
+    return skuIndex.contains(sku);
 }
 
 /**
@@ -438,10 +2298,32 @@ bool Inventory::skuExists(const std::string& sku) const {
  * CRITICAL: Prevents memory leaks
  */
 void Inventory::clearAll() {
-    // Delete each dynamically allocated product
-    for (Product* product : products) {
-        delete product;  // Free memory allocated with new
-    }
-    products.clear();
+    // Delete each dynamically allocated product, invalidating its handles.
+    // Slots themselves are kept so their generations keep increasing.
+    forEachInOrder([this](std::uint32_t index) {
+        releaseSlot(index);
+    });
+    displayOrder.clear();
+    removedCount = 0;
     skuIndex.clear();
+    for (Bitmap& bitmap : typeIndex) {
+        bitmap.clear();
+    }
+    categoryIndex.clear();
+    supplierIndex.clear();
+    licenseIndex.clear();
+    supplierStock.clear();
+    nameIndex.clear();
+    skuOrder.clear();
+    quantityOrder.clear();
+    priceOrder.clear();
+    priceHistogram.clear();
+    quantityHistogram.clear();
+    for (SortView& view : sortViews) {
+        view.order.clear();
+        view.pending.clear();
+        view.valid = false;
+    }
+    queryCache.clear();
+    orderVersion++;
 }
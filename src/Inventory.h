@@ -14,36 +14,393 @@
 
 #include <vector>
 #include <map>
+#include <set>
 #include <string>
+#include <string_view>
 #include <algorithm>
 #include <fstream>
 #include <memory>
+#include <array>
+#include <unordered_map>
+#include <utility>
 #include "Product.h"
 #include "PhysicalProduct.h"
 #include "DigitalProduct.h"
+#include "ProductHandle.h"
+#include "AlignedAllocator.h"
+#include "SkuIndex.h"
+#include "TrigramIndex.h"
+#include "Bitmap.h"
+#include "Query.h"
+#include "ValueHistogram.h"
+#include "SortSpec.h"
+#include "QueryCache.h"
 
 /**
  * @class Inventory
  * @brief Manages a collection of products with full CRUD support
  * 
  * The Inventory class demonstrates STL container usage with:
- * - std::vector<Product*> for ordered storage and iteration
- * - std::map<std::string, Product*> for O(log n) SKU-based lookups
+ * - a slot map (std::vector<Slot>) owning each product at a stable index
+ * - std::vector<uint32_t> holding slot indices in display order; each slot
+ *   records its position there, so removal is O(1) (see removeProduct)
+ * - SkuIndex, an open-addressing hash table for expected O(1) SKU lookups,
+ *   keyed by views of each product's own SKU so no key is ever copied;
+ *   getProduct, findHandle and resolve never allocate, a repeated search
+ *   allocates only the vector it returns, and re-sorting by a built view
+ *   allocates nothing (tests/AllocationTest.cpp)
+ * - Bitmap indexes over the low-cardinality attributes (type, category,
+ *   supplier, license), so combined filters are bitmap intersections
+ * - TrigramIndex over product names for case-insensitive substring search
+ * - std::map<std::string_view, uint32_t> keeping SKUs sorted for prefix,
+ *   range and autocomplete queries in O(log n + k)
+ * - std::set<std::pair<int, uint32_t>> ordering slots by quantity, so
+ *   low-stock queries touch only the products below the threshold
+ * - Query/QueryCursor evaluating composed predicates lazily in one pass,
+ *   with a cost-based planner choosing between a scan and the indexes
+ * - per-supplier std::set<std::pair<int, uint32_t>> of physical products
+ *   ordered by quantity, backing the supplier reorder lists
+ * - std::set<std::pair<int64_t, uint32_t>> ordering slots by price in
+ *   cents for price-band queries that leave the display order alone
+ * - cached sorted views (slot permutations per SortKey), built on first
+ *   use and patched on every change, so sorted listings do not re-sort
+ * 
+ * Products are referenced from outside through ProductHandle values
+ * (slot index + generation). Removing a product bumps its slot's
+ * generation, so stale handles resolve to nullptr instead of dangling.
+ * 
+ * Storage is split hot/cold: price, quantity and type are mirrored per
+ * slot in dense cache-line aligned columns that scans and reports read,
+ * while the Product objects hold the cold descriptive strings. Products
+ * are handed out as const pointers, and the Product setters for every
+ * mirrored or indexed field are private to Inventory, so price and
+ * quantity changes can only go through updateProduct/setPrice/setQuantity
+ * and the columns stay in sync.
  * 
  * Features include add, view, edit, remove operations, searching,
  * sorting, and CSV file persistence.
  */
 class Inventory {
 private:
-    std::vector<Product*> products;           ///< Vector for ordered product storage
-    std::map<std::string, Product*> skuIndex; ///< Map for fast SKU lookups
-    std::string dataFilePath;                 ///< Path to inventory data file
+    /**
+     * @struct Slot
+     * @brief One entry of the slot map
+     */
+    struct Slot {
+        Product* product = nullptr;    ///< Owned product, nullptr when free
+        std::uint32_t generation = 1;  ///< Bumped every time the slot is freed
+        std::uint32_t position = 0;    ///< Index of this slot in displayOrder
+    };
+
+    /// displayOrder marker left behind by a removed product
+    static const std::uint32_t REMOVED = 0xFFFFFFFFu;
+
+    std::vector<Slot> slots;                   ///< Slot map owning all products
+    std::vector<std::uint32_t> freeSlots;      ///< Free slot indices for reuse
+    std::vector<std::uint32_t> displayOrder;   ///< Slot indices in display order (may hold REMOVED)
+    size_t removedCount = 0;                   ///< REMOVED markers in displayOrder
+    SkuIndex skuIndex;                         ///< Hash index from SKU (view into product) to slot
+    std::string dataFilePath;                  ///< Path to inventory data file
+
+    // Bitmap indexes: attribute value -> slots holding it (string values lower-cased)
+    std::array<Bitmap, PRODUCT_TYPE_COUNT> typeIndex;        ///< Slots per ProductType
+    std::unordered_map<std::string, Bitmap> categoryIndex;   ///< Slots per category
+    std::unordered_map<std::string, Bitmap> supplierIndex;   ///< Physical slots per supplier
+    std::unordered_map<std::string, Bitmap> licenseIndex;    ///< Digital slots per license type
+
+    /// Physical slots per lower-cased supplier as (quantity, slot), lowest stock first
+    std::unordered_map<std::string, std::set<std::pair<int, std::uint32_t>>> supplierStock;
+    TrigramIndex nameIndex;                    ///< Trigram index over product names
+    std::map<std::string_view, std::uint32_t> skuOrder; ///< SKUs in sorted order -> slot
+    std::set<std::pair<int, std::uint32_t>> quantityOrder; ///< (quantity, slot) ascending
+    std::set<std::pair<std::int64_t, std::uint32_t>> priceOrder; ///< (price cents, slot) ascending
+
+    // Planner statistics, maintained alongside the price/quantity indexes
+    ValueHistogram priceHistogram;             ///< Distribution of prices in cents
+    ValueHistogram quantityHistogram;          ///< Distribution of quantities
+
+    /**
+     * @struct SortView
+     * @brief Cached permutation of the live slots ordered by one SortKey
+     */
+    struct SortView {
+        std::vector<std::uint32_t> order;      ///< Slot indices in sorted order
+        std::vector<std::uint32_t> pending;    ///< Slots added/removed since order was merged
+        bool valid = false;                    ///< Built; kept current by patchSortViews
+    };
+    /// Views are built lazily by const listings, hence mutable
+    mutable std::array<SortView, SORT_KEY_COUNT> sortViews;
+    unsigned sortThreads = 0;                  ///< Threads for large sorts (0 = one per core)
+    /// Name and category search results; filled by const searches, hence mutable
+    mutable QueryCache queryCache;
+    std::uint64_t orderVersion = 0;            ///< Bumped when display positions are rebuilt
+
+    /**
+     * @brief Bit flags naming the product fields covered by secondary indexes
+     */
+    enum IndexedField : unsigned {
+        FIELD_TYPE = 1u << 0,
+        FIELD_CATEGORY = 1u << 1,
+        FIELD_NAME = 1u << 2,
+        FIELD_SKU = 1u << 3,
+        FIELD_QUANTITY = 1u << 4,
+        FIELD_PRICE = 1u << 5,
+        FIELD_SUPPLIER = 1u << 6,
+        FIELD_LICENSE = 1u << 7,
+        ALL_FIELDS = ~0u
+    };
+
+    /**
+     * @brief QueryKey scopes of the results kept in queryCache
+     */
+    enum CacheScope : unsigned {
+        CACHE_NAME_SEARCH,       ///< searchByName, keyed by term ignoring case
+        CACHE_CATEGORY_SEARCH,   ///< searchByCategory, keyed by term ignoring case
+        CACHE_QUERY              ///< All matches of a paged query, keyed by Query::toString
+    };
+
+    // Hot columns: one entry per slot, mirrored from the owned products
+    AlignedVector<std::int64_t> priceColumn;    ///< Unit price in cents per slot
+    AlignedVector<std::int32_t> quantityColumn; ///< Stock quantity per slot
+    AlignedVector<std::uint8_t> typeColumn;     ///< ProductType per slot
+    AlignedVector<std::uint8_t> liveColumn;     ///< 1 if the slot holds a product
+
+    /**
+     * @brief Helper to refresh each slot's recorded display position
+     * Called after sorting. The SKU index maps to slot indices, which do
+     * not depend on display order, so it is never touched by a sort.
+     */
+    void refreshPositions();
+
+    /**
+     * @brief Drop REMOVED markers from displayOrder, keeping relative order
+     * Runs once markers outnumber live entries, so removal stays amortized O(1)
+     */
+    void compactDisplayOrder();
+
+    /**
+     * @brief Visit live slot indices in display order
+     * @param func Callable invoked as func(uint32_t slotIndex)
+     */
+    template <typename Func>
+    void forEachInOrder(Func func) const {
+        for (std::uint32_t index : displayOrder) {
+            if (index != REMOVED) {
+                func(index);
+            }
+        }
+    }
+
+    /**
+     * @brief Take a free slot (or grow the slot map) for a new product
+     * @param product Product to store
+     * @return Index of the slot now owning the product
+     */
+    std::uint32_t acquireSlot(Product* product);
+
+    /**
+     * @brief Delete a slot's product and invalidate its handles
+     * @param index Slot index to free
+     */
+    void releaseSlot(std::uint32_t index);
+
+    /**
+     * @brief Build the current handle for an occupied slot
+     * @param index Slot index
+     * @return Handle carrying the slot's current generation
+     */
+    ProductHandle handleFor(std::uint32_t index) const;
+
+    /**
+     * @brief Copy a slot's hot fields from its product into the columns
+     * @param index Occupied slot index
+     */
+    void syncHotFields(std::uint32_t index);
+
+    /**
+     * @brief Add a slot to the secondary indexes (type counts, category...)
+     * @param index Occupied slot index
+     * @param fields IndexedField flags selecting which indexes to update
+     */
+    void indexProduct(std::uint32_t index, unsigned fields = ALL_FIELDS);
+
+    /**
+     * @brief Remove a slot from the secondary indexes
+     * Must run while the slot's product still holds its indexed values.
+     * @param index Occupied slot index
+     * @param fields IndexedField flags selecting which indexes to update
+     */
+    void unindexProduct(std::uint32_t index, unsigned fields = ALL_FIELDS);
+
+    /**
+     * @brief Convert slot indices to handles ordered by display position
+     * @param indices Slot indices (reordered in place)
+     * @return Handles in display order
+     */
+    std::vector<ProductHandle> handlesInDisplayOrder(std::vector<std::uint32_t>& indices) const;
+
+    /**
+     * @brief Order two slots for a sorted view
+     * Ties are broken by slot index, so every view is a strict total
+     * order and a slot's entry can be found by binary search.
+     * @param key Sort key
+     * @param a First slot index
+     * @param b Second slot index
+     * @return true if a comes before b
+     */
+    bool sortLess(SortKey key, std::uint32_t a, std::uint32_t b) const;
+
+    /**
+     * @brief Get the cached view for a key, building it if needed
+     * @param key Sort key
+     * @return Live slot indices in sorted order
+     */
+    const std::vector<std::uint32_t>& sortedView(SortKey key) const;
+
+    /**
+     * @brief Number each slot by the rank of its string key
+     * Equal strings share a rank; ranks follow std::string ordering.
+     * @param key SKU, Name or Category
+     * @param ranks Receives one rank per slot (free slots are left 0)
+     */
+    void rankSlots(SortKey key, std::vector<std::uint64_t>& ranks) const;
+
+    /**
+     * @brief Order the live slots by a multi-key specification
+     * @param spec Keys and directions
+     * @return Slot indices in sorted order (ties in display order)
+     */
+    std::vector<std::uint32_t> sortedSlots(const SortSpec& spec) const;
+
+    /**
+     * @brief Print a titled product table in the given slot order
+     * @param title Line printed above the table
+     * @param order Slot indices to display
+     */
+    void displaySlots(const std::string& title, const std::vector<std::uint32_t>& order) const;
+
+    /**
+     * @brief Insert a slot into, or erase it from, the affected built views
+     * Field edits move the slot in place. Adds and removes (ALL_FIELDS)
+     * only queue the slot on each view's pending list, as do edits while
+     * a view has pending slots; mergePendingSlots applies them on the
+     * next read. Erasing must run while the product still holds its old
+     * values.
+     * @param index Occupied slot index
+     * @param fields IndexedField flags that changed
+     * @param insert true to insert, false to erase
+     */
+    void patchSortViews(std::uint32_t index, unsigned fields, bool insert);
+
+    /**
+     * @brief Bring a view's order up to date with its pending slots
+     * Drops every entry of a pending slot in one pass, then sorts the
+     * pending slots that are still live and merges them back in, which
+     * costs O(n + k log k) for k pending slots.
+     * @param key Sort key of a built view
+     */
+    void mergePendingSlots(SortKey key) const;
+
+    /**
+     * @brief Collect candidate slots for a leaf query from its index
+     * Candidates are a superset of the matches and must still be verified.
+     * @param leaf Leaf query with an access path (see planLeaf)
+     * @param indices Receives candidate slot indices
+     */
+    void indexCandidates(const Query& leaf, std::vector<std::uint32_t>& indices) const;
+
+    /**
+     * @brief Collect the slots matching a price or quantity range leaf
+     * Runs the vectorized filter kernels over the hot columns.
+     * @param leaf PriceRange or QuantityRange query
+     * @param indices Receives matching slot indices in slot order
+     */
+    void columnCandidates(const Query& leaf, std::vector<std::uint32_t>& indices) const;
+
+    /**
+     * @brief Estimate how many products match a query
+     * Uses exact bitmap/SKU counts, the value histograms and trigram list
+     * sizes; combined predicates assume independence.
+     * @param query Query to estimate
+     * @return Estimated row count
+     */
+    double estimateRows(const Query& query) const;
+
+    /**
+     * @brief Describe the index access path for a leaf query
+     * @param leaf Leaf query
+     * @param plan Receives the access path, driver and candidate estimate
+     * @return false if no index can answer this leaf
+     */
+    bool planLeaf(const Query& leaf, QueryPlan& plan) const;
+
+    /**
+     * @brief Find where a page continues in displayOrder
+     * @param token Continuation token from a previous page ("" for the first page)
+     * @param start Receives the displayOrder index to resume from
+     * @return false if the token is malformed, or its last product was
+     *         removed and the display order has been rebuilt since
+     */
+    bool resumePosition(const std::string& token, size_t& start) const;
 
     /**
-     * @brief Helper to rebuild the SKU index map from vector
-     * Called after sorting or loading data
+     * @brief Build the continuation token for a page ending at a slot
+     * @param index Occupied slot index of the page's last product
+     * @return Opaque token
      */
-    void rebuildIndex();
+    std::string pageToken(std::uint32_t index) const;
+
+    /**
+     * @brief Choose an access path for one page of a query
+     * @param query Query to plan
+     * @param limit Page size
+     * @return planQuery's plan, or a full scan if one would find the
+     *         page's matches more cheaply than gathering every candidate
+     */
+    QueryPlan planPage(const Query& query, size_t limit) const;
+
+    /**
+     * @brief Collect the first limit + 1 matches at or after a displayOrder index
+     * @param query Predicate to evaluate
+     * @param plan Plan from planPage
+     * @param limit Page size
+     * @param start displayOrder index to start from
+     * @param matches Receives matching handles in display order
+     */
+    void collectPage(const Query& query, const QueryPlan& plan, size_t limit, size_t start,
+                     std::vector<ProductHandle>& matches) const;
+
+    /**
+     * @brief Get the IndexedField flags a query's result depends on
+     * @param query Query to inspect
+     * @return Flags of every field its leaves test
+     */
+    static unsigned queryFields(const Query& query);
+
+    /**
+     * @brief Produce one page of a query, through the query cache when keyed
+     * An index plan's full result is cached once under the key, and every
+     * page is then a binary search for the resume point in it.
+     * @param query Predicate to evaluate
+     * @param key Cache key of the query's full result (nullptr = no caching)
+     * @param fields IndexedField flags the cached result depends on
+     * @param limit Page size (must be at least 1)
+     * @param token Continuation token ("" for the first page)
+     * @param items Receives the page's handles
+     * @param nextToken Receives the next page's token ("" on the last page)
+     * @return false if limit is 0 or the token cannot be resumed
+     */
+    bool fetchPage(const Query& query, const QueryKey* key, unsigned fields, size_t limit,
+                   const std::string& token, std::vector<ProductHandle>& items,
+                   std::string& nextToken) const;
+
+    /**
+     * @brief Cost every access path that can answer a query
+     * @param query Query to plan
+     * @return Full scan first, then one plan per indexable leaf (plus a
+     *         column scan for each price or quantity range)
+     */
+    std::vector<QueryPlan> considerPlans(const Query& query) const;
 
 public:
     /**
@@ -71,7 +428,9 @@ public:
     bool addProduct(Product* product);
 
     /**
-     * @brief Remove a product by SKU
+     * @brief Remove a product by SKU in O(1) (amortized)
+     * The remaining products keep their relative display order; the
+     * removed entry is marked and the order vector is compacted lazily.
      * @param sku Product SKU to remove
      * @return true if removed, false if not found
      */
@@ -81,19 +440,92 @@ public:
      * @brief Update a product's information
      * @param sku SKU of product to update
      * @param name New name (empty to keep current)
-     * @param price New price (-1 to keep current)
+     * @param price New price (negative to keep current)
      * @param quantity New quantity (-1 to keep current)
      * @return true if updated, false if not found
      */
     bool updateProduct(const std::string& sku, const std::string& name = "",
-                       double price = -1, int quantity = -1);
+                       Money price = Money::fromCents(-1), int quantity = -1);
+
+    /**
+     * @brief Set a product's unit price
+     * @param sku SKU of product to update
+     * @param price New price (must be >= 0)
+     * @return true if updated, false if not found or invalid
+     */
+    bool setPrice(const std::string& sku, Money price);
+
+    /**
+     * @brief Set a product's stock quantity
+     * @param sku SKU of product to update
+     * @param quantity New quantity (must be >= 0)
+     * @return true if updated, false if not found or invalid
+     */
+    bool setQuantity(const std::string& sku, int quantity);
+
+    /**
+     * @brief Set a product's category (keeps the category index current)
+     * @param sku SKU of product to update
+     * @param category New category
+     * @return true if updated, false if not found
+     */
+    bool setCategory(const std::string& sku, const std::string& category);
+
+    /**
+     * @brief Set a product's name (keeps the name index current)
+     * @param sku SKU of product to update
+     * @param name New name
+     * @return true if updated, false if not found
+     */
+    bool setName(const std::string& sku, const std::string& name);
+
+    /**
+     * @brief Set a physical product's supplier (keeps the supplier index current)
+     * @param sku SKU of product to update
+     * @param supplier New supplier name
+     * @return true if updated, false if not found or not a physical product
+     */
+    bool setSupplier(const std::string& sku, const std::string& supplier);
+
+    /**
+     * @brief Set a digital product's license type (keeps the license index current)
+     * @param sku SKU of product to update
+     * @param licenseType New license type
+     * @return true if updated, false if not found or not a digital product
+     */
+    bool setLicenseType(const std::string& sku, const std::string& licenseType);
 
     /**
      * @brief Get a product by SKU
+     * The pointer is only valid until the product is removed or the
+     * inventory is reloaded; keep a ProductHandle for longer-lived references.
      * @param sku Product SKU
      * @return Pointer to product or nullptr if not found
      */
-    Product* getProduct(const std::string& sku) const;
+    const Product* getProduct(const std::string& sku) const;
+
+    // ==================== HANDLES ====================
+
+    /**
+     * @brief Get a stable handle for a product by SKU
+     * @param sku Product SKU
+     * @return Handle to the product, or a null handle if not found
+     */
+    ProductHandle findHandle(const std::string& sku) const;
+
+    /**
+     * @brief Resolve a handle to its product in O(1)
+     * @param handle Handle previously issued by this inventory
+     * @return Pointer to product, or nullptr if the handle is stale or null
+     */
+    const Product* resolve(ProductHandle handle) const;
+
+    /**
+     * @brief Check whether a handle still refers to a live product
+     * @param handle Handle to check
+     * @return true if resolve() would return a product
+     */
+    bool isValid(ProductHandle handle) const;
 
     // ==================== VIEW & DISPLAY ====================
     
@@ -108,35 +540,449 @@ public:
     void displaySummary() const;
 
     /**
-     * @brief Display products with low stock
+     * @brief Display products with low stock, lowest quantity first
      * @param threshold Quantity threshold for "low stock" (default: 10)
      */
     void displayLowStock(int threshold = 10) const;
 
+    /**
+     * @brief Display one reorder list per supplier
+     * @param threshold Quantity threshold for "low stock"
+     */
+    void displayReorderLists(int threshold = 10) const;
+
+    /**
+     * @brief Display the k products with the highest stock value
+     * @param k Number of products to show
+     */
+    void displayTopByValue(size_t k = 10) const;
+
+    /**
+     * @brief Display the hot/cold storage layout report
+     * Shows bytes per product in each table and measured scan throughput
+     * for the summary and low-stock scans over both layouts.
+     */
+    void displayLayoutReport() const;
+
     // ==================== SEARCH & FILTER ====================
     
     /**
-     * @brief Search products by name (partial match)
+     * @brief Search products by name (case-insensitive partial match)
+     * Terms of three or more characters are narrowed with the trigram
+     * index before verification; shorter terms fall back to a scan.
+     * Results are cached by term, ignoring case, until a name changes or
+     * products are added, removed or reordered. The cache is probed with a
+     * view of the term, so a cached search only allocates the returned
+     * vector (and nothing when it is empty).
      * @param searchTerm Search string
-     * @return Vector of matching products
+     * @return Handles of matching products
      */
-    std::vector<Product*> searchByName(const std::string& searchTerm) const;
+    std::vector<ProductHandle> searchByName(const std::string& searchTerm) const;
 
     /**
-     * @brief Search products by category
+     * @brief Search products by category (case-insensitive partial match)
+     * Only the distinct categories are scanned, not every product.
+     * Results are cached like searchByName, keyed on category changes.
      * @param category Category to filter by
-     * @return Vector of matching products
+     * @return Handles of matching products in display order
+     */
+    std::vector<ProductHandle> searchByCategory(const std::string& category) const;
+
+    /**
+     * @brief Find products in exactly one category (case-insensitive)
+     * Resolved with a single hash lookup in the category index.
+     * @param category Category name
+     * @return Handles of matching products in display order
+     */
+    std::vector<ProductHandle> searchByCategoryExact(const std::string& category) const;
+
+    /**
+     * @struct AttributeFilter
+     * @brief Exact-match constraints for filterByAttributes
+     * Empty fields are unconstrained; string matches ignore case.
+     */
+    struct AttributeFilter {
+        std::string type;         ///< "Physical" or "Digital"
+        std::string category;     ///< Category name
+        std::string supplier;     ///< Supplier (physical products only)
+        std::string licenseType;  ///< License type (digital products only)
+    };
+
+    /**
+     * @brief Find products matching every given attribute
+     * Intersects the attribute bitmaps, smallest first, so the cost
+     * follows the bitmap sizes rather than the inventory size.
+     * @param filter Attributes to match
+     * @return Handles of matching products in display order
      */
-    std::vector<Product*> searchByCategory(const std::string& category) const;
+    std::vector<ProductHandle> filterByAttributes(const AttributeFilter& filter) const;
 
     /**
      * @brief Search products by type (Physical/Digital)
      * @param type Product type string
-     * @return Vector of matching products
+     * @return Handles of matching products
+     */
+    std::vector<ProductHandle> searchByType(const std::string& type) const;
+
+    /**
+     * @brief Search products by type tag
+     * @param type Product type to match
+     * @return Handles of matching products
+     */
+    std::vector<ProductHandle> searchByType(ProductType type) const;
+
+    /**
+     * @brief Visit every product of one type in storage order
+     * @param type Product type to visit
+     * Products are passed as const pointers, like everywhere else they are
+     * handed out, so the callback cannot bypass the hot columns.
+     * @param func Callable invoked as func(const Product*, ProductHandle) for each match
+     */
+    template <typename Func>
+    void forEachOfType(ProductType type, Func func) const {
+        const std::uint8_t tag = static_cast<std::uint8_t>(type);
+        forEachInOrder([&](std::uint32_t index) {
+            if (typeColumn[index] == tag) {
+                const Product* product = slots[index].product;
+                func(product, handleFor(index));
+            }
+        });
+    }
+
+    /**
+     * @brief Find products whose SKU starts with a prefix (e.g. "TOOL-")
+     * SKUs are case-sensitive. Runs in O(log n + k) on the ordered SKU index.
+     * @param prefix SKU prefix (empty matches every SKU)
+     * @param limit Maximum results to return (0 = no limit)
+     * @return Handles of matching products in SKU order
+     */
+    std::vector<ProductHandle> findBySkuPrefix(const std::string& prefix, size_t limit = 0) const;
+
+    /**
+     * @brief Find products whose SKU lies in [first, last] (inclusive)
+     * Runs in O(log n + k) on the ordered SKU index.
+     * @param first Lowest SKU to include
+     * @param last Highest SKU to include
+     * @return Handles of matching products in SKU order
+     */
+    std::vector<ProductHandle> findBySkuRange(const std::string& first, const std::string& last) const;
+
+    /**
+     * @brief Suggest SKUs that complete a prefix
+     * @param prefix Typed prefix
+     * @param limit Maximum suggestions to return
+     * @return Matching SKUs in sorted order
      */
-    std::vector<Product*> searchByType(const std::string& type) const;
+    std::vector<std::string> autocompleteSku(const std::string& prefix, size_t limit = 10) const;
+
+    /**
+     * @brief Find products with quantity below a threshold
+     * Walks the quantity index in O(log n + k), or filters the quantity
+     * column with the vectorized kernels when many products match.
+     * @param threshold Quantity threshold (exclusive)
+     * @return Handles ordered by ascending quantity (lowest stock first)
+     */
+    std::vector<ProductHandle> findLowStock(int threshold) const;
+
+    /**
+     * @class QueryCursor
+     * @brief Lazily yields the products matching a Query in display order
+     *
+     * The cursor follows the plan chosen by planQuery: it either walks the
+     * display order or the candidates of one secondary index, testing each
+     * product against the full query as it goes, so no result list is
+     * built. A full scan starts in O(1); an index plan gathers the index's
+     * c candidates and sorts them into display order when the cursor is
+     * created, an O(c log c) first-result cost the planner charges as
+     * sortCost. Only the predicate tests are deferred. Like an iterator, a
+     * cursor must not be used after the inventory is modified.
+     */
+    class QueryCursor {
+    public:
+        /**
+         * @brief Advance to the next matching product
+         * @param handle Receives the product's handle
+         * @return false once there are no more matches
+         */
+        bool next(ProductHandle& handle);
+
+        /**
+         * @brief Get the plan the cursor is executing
+         * @return Chosen query plan
+         */
+        const QueryPlan& getPlan() const;
+
+        /**
+         * @brief Get the number of products tested so far
+         * @return Products examined (matching or not)
+         */
+        size_t getExamined() const;
+
+    private:
+        friend class Inventory;
+
+        QueryCursor(const Inventory& inventory, const Query& query, const QueryPlan& plan);
+
+        const Inventory* inventory;              ///< Inventory being queried
+        Query query;                             ///< Predicate every result satisfies
+        std::vector<std::uint32_t> candidates;   ///< Index candidates in display order
+        bool useCandidates;                      ///< Walk candidates instead of displayOrder
+        size_t position;                         ///< Next candidate/displayOrder entry
+        QueryPlan plan;                          ///< Access path being executed
+        size_t examined;                         ///< Products tested so far
+    };
+
+    /**
+     * @brief Choose the cheapest access path for a query
+     * Compares a full scan against each index that can answer the query
+     * (or one of its AND operands) using maintained statistics.
+     * @param query Query to plan
+     * @return Cheapest plan
+     */
+    QueryPlan planQuery(const Query& query) const;
+
+    /**
+     * @brief Describe and run a query's plan
+     * Lists every plan considered with its estimates, then runs the
+     * chosen one and reports estimated against actual rows.
+     * @param query Query to explain
+     * @return Multi-line report
+     */
+    std::string explain(const Query& query) const;
+
+    /**
+     * @brief Start a lazy query
+     * @param query Predicate to evaluate
+     * @return Cursor yielding matching handles in display order
+     */
+    QueryCursor query(const Query& query) const;
+
+    /**
+     * @brief Run a query to completion
+     * @param query Predicate to evaluate
+     * @return Handles of all matching products in display order
+     */
+    std::vector<ProductHandle> findAll(const Query& query) const;
+
+    /**
+     * @struct ReorderLine
+     * @brief One low-stock physical product on a supplier reorder list
+     */
+    struct ReorderLine {
+        ProductHandle handle;        ///< Product on the list
+        std::string sku;             ///< Product SKU
+        int quantity = 0;            ///< Units currently in stock
+        int reorderQuantity = 0;     ///< Units needed to reach the threshold
+        double weight = 0.0;         ///< Weight of the reorder (lbs)
+    };
+
+    /**
+     * @struct ReorderList
+     * @brief Low-stock products from one supplier, lowest stock first
+     */
+    struct ReorderList {
+        std::string supplier;               ///< Supplier name
+        std::vector<ReorderLine> lines;     ///< Products to reorder
+        double totalWeight = 0.0;           ///< Sum of the line weights (lbs)
+    };
+
+    /**
+     * @brief Build the reorder list for one supplier (case-insensitive)
+     * Reads only the supplier's products below the threshold.
+     * @param supplier Supplier name
+     * @param threshold Quantity threshold (exclusive)
+     * @return Reorder list (no lines if nothing is low or supplier unknown)
+     */
+    ReorderList getReorderList(const std::string& supplier, int threshold) const;
+
+    /**
+     * @brief Build reorder lists for every supplier with low-stock products
+     * @param threshold Quantity threshold (exclusive)
+     * @return Non-empty lists sorted by supplier name
+     */
+    std::vector<ReorderList> getReorderLists(int threshold) const;
+
+    /**
+     * @brief Find products priced within [low, high] (inclusive)
+     * Runs in O(log n + k) on the price index; display order is unchanged.
+     * @param low Lowest unit price to include
+     * @param high Highest unit price to include
+     * @return Handles ordered by ascending price
+     */
+    std::vector<ProductHandle> findByPriceRange(Money low, Money high) const;
+
+    /**
+     * @brief Find products whose stock value (price x quantity) is at least a minimum
+     * Filters the hot price and quantity columns with the vectorized kernels.
+     * @param minimum Smallest stock value to include
+     * @return Handles in display order
+     */
+    std::vector<ProductHandle> findByMinValue(Money minimum) const;
+
+    /**
+     * @brief Find the k products with the highest stock value (price x quantity)
+     * Keeps a k-entry heap while scanning the hot columns, so it runs in
+     * O(n log k) and leaves the display order untouched. Equal values keep
+     * their display order.
+     * @param k Number of products to return
+     * @return Up to k handles, highest value first
+     */
+    std::vector<ProductHandle> topByValue(size_t k) const;
+
+    /**
+     * @brief Get the name/category search cache counters
+     * Counters cover full and paged searches and survive reloads;
+     * lookups made while the cache is disabled count as misses.
+     * @return Hits, misses, stale entries, evictions, size and capacity
+     */
+    QueryCacheStats getQueryCacheStats() const;
+
+    /**
+     * @brief Set how many search results are cached (default 64)
+     * Shrinking evicts the least recently used entries first.
+     * @param capacity Maximum cached searches (0 disables the cache)
+     */
+    void setQueryCacheCapacity(size_t capacity);
+
+    /**
+     * @brief Zero the search cache's hit, miss, stale and eviction counters
+     * Cached results are kept, so later hits still count.
+     */
+    void resetQueryCacheStats();
+
+    /**
+     * @brief Display the search cache hit rate and counters
+     */
+    void displayQueryCacheStats() const;
+
+    // ==================== PAGING ====================
+
+    /**
+     * @struct Page
+     * @brief One page of a listing or search
+     *
+     * The token is opaque and names the page's last product, so the next
+     * page starts right after it in the current display order even if the
+     * inventory was edited in between. It is rejected (the call returns
+     * false) only if that product was removed and the display order was
+     * rebuilt by a sort, a compaction or a reload.
+     */
+    struct Page {
+        std::vector<ProductHandle> items;   ///< Handles on this page, in display order
+        std::string nextToken;              ///< Token for the next page; empty on the last page
+    };
+
+    /**
+     * @brief Get one page of the inventory in display order
+     * Runs in O(limit) plus any removed entries skipped, wherever the page starts.
+     * @param limit Products per page (at least 1)
+     * @param token Token from the previous page ("" for the first page)
+     * @param page Receives the products and the next token
+     * @return false if limit is 0 or the token can no longer be resumed
+     */
+    bool listPage(size_t limit, const std::string& token, Page& page) const;
+
+    /**
+     * @brief Get one page of a query's matches in display order
+     * Scans from the resume point until the page is full when that is
+     * cheaper than the index planQuery picked. Otherwise the first page
+     * gathers every match through the index in O(c log c) and caches it
+     * (one entry per query, invalidated like searches), so each further
+     * page costs O(log c + limit).
+     * @param query Predicate to evaluate
+     * @param limit Matches per page (at least 1)
+     * @param token Token from the previous page ("" for the first page)
+     * @param page Receives the matches and the next token
+     * @return false if limit is 0 or the token can no longer be resumed
+     */
+    bool queryPage(const Query& query, size_t limit, const std::string& token, Page& page) const;
+
+    /**
+     * @brief Get one page of a name search (case-insensitive partial match)
+     * Pages are cut from the cached searchByName result for the term,
+     * which an index-planned first page fills; see queryPage.
+     * @param searchTerm Search string
+     * @param limit Matches per page (at least 1)
+     * @param token Token from the previous page ("" for the first page)
+     * @param page Receives the matches and the next token
+     * @return false if limit is 0 or the token can no longer be resumed
+     */
+    bool searchByNamePage(const std::string& searchTerm, size_t limit, const std::string& token,
+                          Page& page) const;
+
+    /**
+     * @brief Get one page of a category search (case-insensitive partial match)
+     * Pages are cut from the cached searchByCategory result for the term,
+     * which an index-planned first page fills; see queryPage.
+     * @param category Category to filter by
+     * @param limit Matches per page (at least 1)
+     * @param token Token from the previous page ("" for the first page)
+     * @param page Receives the matches and the next token
+     * @return false if limit is 0 or the token can no longer be resumed
+     */
+    bool searchByCategoryPage(const std::string& category, size_t limit, const std::string& token,
+                              Page& page) const;
 
     // ==================== SORTING ====================
+
+    /**
+     * @brief List products in sorted order without changing the display order
+     * The view is sorted once and then kept current as products change,
+     * so repeated calls cost O(n).
+     * @param key Sort key
+     * @return Handles in sorted order
+     */
+    std::vector<ProductHandle> getSortedView(SortKey key) const;
+
+    /**
+     * @brief Display products in sorted order without changing the display order
+     * @param key Sort key
+     */
+    void displaySorted(SortKey key) const;
+
+    /**
+     * @brief List products ordered by several keys without changing the display order
+     * Each product's keys are extracted once into a row of integers
+     * (strings become ranks), so the sort compares rows with no virtual
+     * calls or string compares.
+     * @param spec Keys and directions, most significant first
+     * @return Handles in sorted order; full ties keep display order
+     */
+    std::vector<ProductHandle> getSorted(const SortSpec& spec) const;
+
+    /**
+     * @brief Display products ordered by several keys without changing the display order
+     * @param spec Keys and directions, most significant first
+     */
+    void displaySorted(const SortSpec& spec) const;
+
+    /**
+     * @brief Reorder the inventory by several keys (stable)
+     * @param spec Keys and directions, most significant first
+     */
+    void sortBy(const SortSpec& spec);
+
+    /**
+     * @brief Set how many threads may build a large sorted view
+     * Views of at least PARALLEL_SORT_THRESHOLD products sorted by
+     * comparison (SKU, name) use a parallel merge sort; the result is the
+     * same for every thread count.
+     * @param threads Thread limit (0 = one per hardware thread, 1 = serial)
+     */
+    void setSortThreads(unsigned threads);
+
+    /**
+     * @brief Get the number of threads large sorts will use
+     * @return Thread limit after resolving 0 to the hardware thread count
+     */
+    unsigned getSortThreads() const;
+
+    /**
+     * @brief Reorder the inventory by a key
+     * Copies the cached view, so only the first sort by a key is O(n log n).
+     * @param key Sort key
+     */
+    void sortBy(SortKey key);
     
     /**
      * @brief Sort inventory by SKU (alphabetically)
@@ -191,11 +1037,19 @@ public:
      */
     size_t getProductCount() const;
 
+    /**
+     * @brief Get the number of products of one type
+     * Maintained incrementally, so this is O(1)
+     * @param type Product type to count
+     * @return Product count for that type
+     */
+    size_t getCountByType(ProductType type) const;
+
     /**
      * @brief Calculate total inventory value
-     * @return Sum of all product values (price * quantity)
+     * @return Exact sum of all product values (price * quantity)
      */
-    double getTotalValue() const;
+    Money getTotalValue() const;
 
     /**
      * @brief Check if inventory is empty
@@ -0,0 +1,178 @@
+/**
+ * @file Money.cpp
+ * @brief Implementation of the Money fixed-point type
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * Implements exact parsing, formatting and integer arithmetic for Money.
+ * Parsing works digit by digit so CSV values never pass through a double.
+ */
+
+#include "Money.h"
+#include <cmath>
+#include <cctype>
+
+// ==================== CONSTRUCTION ====================
+
+Money::Money() : cents(0) {
+}
+
+Money Money::fromCents(std::int64_t cents) {
+    Money money;
+    money.cents = cents;
+    return money;
+}
+
+/**
+ * Rounds a dollar value to the nearest cent
+ */
+Money Money::fromDouble(double dollars) {
+    return fromCents(static_cast<std::int64_t>(std::llround(dollars * SCALE)));
+}
+
+/**
+ * Parses [spaces][+|-]digits[.digits][spaces] exactly
+ * The first digit past DECIMALS decides rounding (half up in magnitude)
+ */
+bool Money::parse(const std::string& text, Money& money) {
+    size_t i = 0;
+    size_t end = text.size();
+    while (i < end && std::isspace(static_cast<unsigned char>(text[i]))) {
+        ++i;
+    }
+    while (end > i && std::isspace(static_cast<unsigned char>(text[end - 1]))) {
+        --end;
+    }
+
+    bool negative = false;
+    if (i < end && (text[i] == '+' || text[i] == '-')) {
+        negative = (text[i] == '-');
+        ++i;
+    }
+
+    std::int64_t whole = 0;
+    int wholeDigits = 0;
+    while (i < end && std::isdigit(static_cast<unsigned char>(text[i]))) {
+        if (++wholeDigits > 15) {
+            return false;  // Would overflow once scaled to cents
+        }
+        whole = whole * 10 + (text[i] - '0');
+        ++i;
+    }
+
+    std::int64_t fraction = 0;
+    int fractionDigits = 0;
+    bool roundUp = false;
+    if (i < end && text[i] == '.') {
+        ++i;
+        while (i < end && std::isdigit(static_cast<unsigned char>(text[i]))) {
+            if (fractionDigits < DECIMALS) {
+                fraction = fraction * 10 + (text[i] - '0');
+            } else if (fractionDigits == DECIMALS) {
+                roundUp = (text[i] >= '5');
+            }
+            ++fractionDigits;
+            ++i;
+        }
+    }
+
+    if (i != end || (wholeDigits == 0 && fractionDigits == 0)) {
+        return false;  // Trailing garbage or no digits at all
+    }
+
+    for (int d = fractionDigits; d < DECIMALS; ++d) {
+        fraction *= 10;  // "9.9" -> 90 cents
+    }
+
+    std::int64_t value = whole * SCALE + fraction + (roundUp ? 1 : 0);
+    money = fromCents(negative ? -value : value);
+    return true;
+}
+
+// ==================== ACCESSORS ====================
+
+std::int64_t Money::getCents() const {
+    return cents;
+}
+
+double Money::toDouble() const {
+    return static_cast<double>(cents) / SCALE;
+}
+
+/**
+ * Formats without going through floating point
+ */
+std::string Money::toString() const {
+    std::uint64_t magnitude = (cents < 0) ? 0 - static_cast<std::uint64_t>(cents)
+                                          : static_cast<std::uint64_t>(cents);
+    std::string fraction = std::to_string(magnitude % SCALE);
+    fraction.insert(0, DECIMALS - fraction.size(), '0');
+    return (cents < 0 ? "-" : "") + std::to_string(magnitude / SCALE) + "." + fraction;
+}
+
+bool Money::isNegative() const {
+    return cents < 0;
+}
+
+// ==================== ARITHMETIC ====================
+
+Money Money::operator+(const Money& other) const {
+    return fromCents(cents + other.cents);
+}
+
+Money Money::operator-(const Money& other) const {
+    return fromCents(cents - other.cents);
+}
+
+Money& Money::operator+=(const Money& other) {
+    cents += other.cents;
+    return *this;
+}
+
+Money& Money::operator-=(const Money& other) {
+    cents -= other.cents;
+    return *this;
+}
+
+Money Money::operator*(std::int64_t quantity) const {
+    return fromCents(cents * quantity);
+}
+
+/**
+ * Percentage scaling is the one place a fraction of a cent can appear,
+ * so the result is rounded to the nearest cent
+ */
+Money Money::percentOf(double percentage) const {
+    return fromCents(static_cast<std::int64_t>(
+        std::llround(static_cast<double>(cents) * percentage / 100.0)));
+}
+
+// ==================== COMPARISON ====================
+
+bool Money::operator==(const Money& other) const {
+    return cents == other.cents;
+}
+
+bool Money::operator!=(const Money& other) const {
+    return cents != other.cents;
+}
+
+bool Money::operator<(const Money& other) const {
+    return cents < other.cents;
+}
+
+bool Money::operator<=(const Money& other) const {
+    return cents <= other.cents;
+}
+
+bool Money::operator>(const Money& other) const {
+    return cents > other.cents;
+}
+
+bool Money::operator>=(const Money& other) const {
+    return cents >= other.cents;
+}
+
+std::ostream& operator<<(std::ostream& os, const Money& money) {
+    return os << money.toString();
+}
@@ -0,0 +1,128 @@
+/**
+ * @file Money.h
+ * @brief Fixed-point money type for SmallBiz Inventory System
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * This file defines the Money class, an exact fixed-point amount stored as
+ * an integer number of cents. Prices, product values and inventory totals
+ * all use Money so sums never drift and do not depend on summation order.
+ */
+
+#ifndef MONEY_H
+#define MONEY_H
+
+#include <cstdint>
+#include <string>
+#include <iostream>
+
+/**
+ * @class Money
+ * @brief Exact currency amount with a fixed number of decimal places
+ *
+ * The amount is held as a signed 64-bit count of the smallest unit
+ * (1 / SCALE of a dollar). Arithmetic is plain integer arithmetic, so
+ * aggregates are exact and associative.
+ */
+class Money {
+private:
+    std::int64_t cents;     ///< Amount in units of 1/SCALE
+
+public:
+    static const int DECIMALS = 2;          ///< Decimal places kept
+    static const std::int64_t SCALE = 100;  ///< 10^DECIMALS units per dollar
+
+    /**
+     * @brief Default constructor
+     * Initializes to zero
+     */
+    Money();
+
+    /**
+     * @brief Create an amount from a raw count of cents
+     * @param cents Amount in units of 1/SCALE
+     * @return Money holding exactly that amount
+     */
+    static Money fromCents(std::int64_t cents);
+
+    /**
+     * @brief Create an amount from a floating-point dollar value
+     * Rounds to the nearest cent (half away from zero)
+     * @param dollars Dollar amount
+     * @return Rounded Money amount
+     */
+    static Money fromDouble(double dollars);
+
+    /**
+     * @brief Parse a decimal string such as "29.99" or "29.990000"
+     * Digits beyond DECIMALS are rounded half up; no floating point is used.
+     * @param text Text to parse (surrounding spaces allowed)
+     * @param money Receives the parsed amount on success
+     * @return true if text was a valid decimal number
+     */
+    static bool parse(const std::string& text, Money& money);
+
+    // ==================== ACCESSORS ====================
+
+    /**
+     * @brief Get the raw amount in cents
+     * @return Amount in units of 1/SCALE
+     */
+    std::int64_t getCents() const;
+
+    /**
+     * @brief Convert to a floating-point dollar value (for display math only)
+     * @return Approximate dollar amount
+     */
+    double toDouble() const;
+
+    /**
+     * @brief Format as a plain decimal string with DECIMALS places
+     * @return String like "149.99" or "-3.50"
+     */
+    std::string toString() const;
+
+    /**
+     * @brief Check whether the amount is below zero
+     * @return true if negative
+     */
+    bool isNegative() const;
+
+    // ==================== ARITHMETIC ====================
+
+    Money operator+(const Money& other) const;
+    Money operator-(const Money& other) const;
+    Money& operator+=(const Money& other);
+    Money& operator-=(const Money& other);
+
+    /**
+     * @brief Multiply by a whole quantity (exact)
+     * @param quantity Number of units
+     * @return Amount times quantity
+     */
+    Money operator*(std::int64_t quantity) const;
+
+    /**
+     * @brief Scale by a percentage, rounding to the nearest cent
+     * @param percentage Percentage to keep (e.g. 85 keeps 85%)
+     * @return Scaled amount
+     */
+    Money percentOf(double percentage) const;
+
+    // ==================== COMPARISON ====================
+
+    bool operator==(const Money& other) const;
+    bool operator!=(const Money& other) const;
+    bool operator<(const Money& other) const;
+    bool operator<=(const Money& other) const;
+    bool operator>(const Money& other) const;
+    bool operator>=(const Money& other) const;
+};
+
+/**
+ * @brief Stream a Money amount as its decimal string
+ * Honors the stream's field width like any string insertion.
+ */
+std::ostream& operator<<(std::ostream& os, const Money& money);
+
+#endif // MONEY_H
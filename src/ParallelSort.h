@@ -0,0 +1,142 @@
+/**
+ * @file ParallelSort.h
+ * @brief Multi-threaded merge sort for SmallBiz Inventory System
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * This file defines parallelSort, a merge sort that sorts one chunk of
+ * the range per thread with std::sort and then merges neighbouring
+ * chunks in parallel rounds. Inventory uses it to build the SKU and
+ * name views of large inventories.
+ */
+
+#ifndef PARALLELSORT_H
+#define PARALLELSORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+/// Smallest chunk worth handing to its own thread
+const std::size_t PARALLEL_SORT_MIN_CHUNK = 8192;
+
+/**
+ * @class SortWorkers
+ * @brief The threads of one parallelSort round, joined however the round ends
+ *
+ * A task that cannot get its own thread (std::thread throws
+ * std::system_error when the system is out of threads) runs on the
+ * calling thread instead, and the destructor joins every started thread,
+ * so an exception on the calling thread never leaves a joinable
+ * std::thread behind to call std::terminate.
+ */
+class SortWorkers {
+private:
+    std::vector<std::thread> threads;   ///< Started threads, not yet joined
+
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Most tasks the round will start (reserved up front so
+     *        adding a thread never reallocates)
+     */
+    explicit SortWorkers(std::size_t capacity) {
+        threads.reserve(capacity);
+    }
+
+    SortWorkers(const SortWorkers&) = delete;
+    SortWorkers& operator=(const SortWorkers&) = delete;
+
+    /**
+     * @brief Destructor - joins any thread still running
+     */
+    ~SortWorkers() {
+        join();
+    }
+
+    /**
+     * @brief Run a task on a new thread, or inline if none can be started
+     * @param task Callable taking no arguments
+     */
+    template <typename Task>
+    void run(Task task) {
+        try {
+            threads.emplace_back(task);
+        } catch (const std::system_error&) {
+            task();
+        }
+    }
+
+    /**
+     * @brief Wait for every started thread
+     */
+    void join() {
+        for (std::thread& thread : threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+        threads.clear();
+    }
+};
+
+/**
+ * @brief Sort a random-access range using up to the given number of threads
+ *
+ * The calling thread sorts the first chunk itself. With a comparator
+ * that is a strict total order (no two elements compare equal) the
+ * result is identical to std::sort's whatever the thread count;
+ * otherwise equal elements may come out in a different order. If a
+ * thread cannot be started its chunk or merge runs on the calling thread,
+ * so the result is the same, only slower.
+ *
+ * @tparam Iterator Random-access iterator
+ * @tparam Compare Strict weak ordering; called concurrently, so it must
+ *         only read shared state, and must not throw (an exception on a
+ *         worker thread ends the program)
+ * @param first Start of the range
+ * @param last End of the range
+ * @param less Comparator
+ * @param threads Maximum threads to use (1 = plain std::sort)
+ */
+template <typename Iterator, typename Compare>
+void parallelSort(Iterator first, Iterator last, Compare less, unsigned threads) {
+    const std::size_t count = static_cast<std::size_t>(std::distance(first, last));
+    const std::size_t chunks = std::min<std::size_t>(threads, count / PARALLEL_SORT_MIN_CHUNK);
+    if (chunks <= 1) {
+        std::sort(first, last, less);
+        return;
+    }
+
+    std::vector<Iterator> bounds;
+    for (std::size_t chunk = 0; chunk <= chunks; ++chunk) {
+        bounds.push_back(first + static_cast<std::ptrdiff_t>(count * chunk / chunks));
+    }
+
+    SortWorkers workers(chunks);
+    for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+        workers.run([&bounds, less, chunk]() {
+            std::sort(bounds[chunk], bounds[chunk + 1], less);
+        });
+    }
+    std::sort(bounds[0], bounds[1], less);
+    workers.join();
+
+    // Each round merges pairs of sorted runs, doubling the run length
+    for (std::size_t width = 1; width < chunks; width *= 2) {
+        for (std::size_t left = 0; left + width < chunks; left += 2 * width) {
+            Iterator begin = bounds[left];
+            Iterator middle = bounds[left + width];
+            Iterator end = bounds[std::min(left + 2 * width, chunks)];
+            workers.run([begin, middle, end, less]() {
+                std::inplace_merge(begin, middle, end, less);
+            });
+        }
+        workers.join();
+    }
+}
+
+#endif // PARALLELSORT_H
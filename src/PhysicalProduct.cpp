@@ -17,17 +17,17 @@
  * Default constructor - calls base class constructor
  */
 PhysicalProduct::PhysicalProduct() 
-    : Product(), weight(0.0), supplier("Unknown") {
-    setCategory("Physical");
+    : Product(ProductType::Physical), weight(0.0), supplier("Unknown") {
+    category = "Physical";
 }
 
 /**
  * Parameterized constructor with all physical product attributes
  */
 PhysicalProduct::PhysicalProduct(const std::string& sku, const std::string& name,
-                                 double price, int quantity, const std::string& category,
+                                 Money price, int quantity, const std::string& category,
                                  double weight, const std::string& supplier)
-    : Product(sku, name, price, quantity, category), supplier(supplier) {
+    : Product(ProductType::Physical, sku, name, price, quantity, category), supplier(supplier) {
     this->weight = (weight >= 0) ? weight : 0.0;
 }
 
@@ -44,7 +44,7 @@ double PhysicalProduct::getWeight() const {
     return weight;
 }
 
-std::string PhysicalProduct::getSupplier() const {
+const std::string& PhysicalProduct::getSupplier() const {
     return supplier;
 }
 
@@ -119,20 +119,24 @@ std::string PhysicalProduct::toCSV() const {
 /**
  * Factory method to create a PhysicalProduct from CSV data
  * @param csvLine Format: Physical,sku,name,price,qty,category,weight,supplier
- * @return New PhysicalProduct pointer (caller responsible for deletion)
+ * @return New PhysicalProduct pointer (caller responsible for deletion),
+ *         or nullptr if the price field is malformed
  */
 PhysicalProduct* PhysicalProduct::fromCSV(const std::string& csvLine) {
     std::stringstream ss(csvLine);
-    std::string type, sku, name, category, supplier;
-    double price, weight;
+    std::string type, sku, name, priceField, category, supplier;
+    Money price;
+    double weight;
     int quantity;
 
     // Parse CSV fields
     std::getline(ss, type, ',');      // "Physical"
     std::getline(ss, sku, ',');
     std::getline(ss, name, ',');
-    ss >> price;
-    ss.ignore(1);  // Skip comma
+    std::getline(ss, priceField, ',');
+    if (!Money::parse(priceField, price)) {
+        return nullptr;  // Malformed price - skip this record
+    }
     ss >> quantity;
     ss.ignore(1);
     std::getline(ss, category, ',');
@@ -45,7 +45,7 @@ public:
      * @param supplier Supplier name
      */
     PhysicalProduct(const std::string& sku, const std::string& name,
-                    double price, int quantity, const std::string& category,
+                    Money price, int quantity, const std::string& category,
                     double weight, const std::string& supplier);
 
     /**
@@ -63,9 +63,9 @@ public:
 
     /**
      * @brief Get the supplier name
-     * @return Supplier string
+     * @return Reference to the supplier name
      */
-    std::string getSupplier() const;
+    const std::string& getSupplier() const;
 
     // ==================== SETTERS ====================
     
@@ -76,12 +76,17 @@ public:
      */
     bool setWeight(double weight);
 
+private:
+    friend class Inventory;
+
     /**
      * @brief Set the supplier name
+     * Private: Inventory indexes suppliers (see Inventory::setSupplier).
      * @param supplier New supplier name
      */
     void setSupplier(const std::string& supplier);
 
+public:
     // ==================== OVERRIDDEN VIRTUAL FUNCTIONS ====================
     
     /**
@@ -111,7 +116,7 @@ public:
     /**
      * @brief Create a PhysicalProduct from CSV data
      * @param csvLine Comma-separated product data
-     * @return Pointer to new PhysicalProduct (caller owns memory)
+     * @return Pointer to new PhysicalProduct (caller owns memory), or nullptr if malformed
      */
     static PhysicalProduct* fromCSV(const std::string& csvLine);
 };
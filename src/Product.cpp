@@ -10,25 +10,26 @@
  */
 
 #include "Product.h"
+#include <cctype>
 
 // ==================== CONSTRUCTORS & DESTRUCTOR ====================
 
 /**
  * Default constructor - initializes with safe default values
  */
-Product::Product() 
-    : sku(""), name(""), price(0.0), quantity(0), category("General") {
+Product::Product(ProductType type) 
+    : sku(""), name(""), price(), quantity(0), category("General"), type(type) {
 }
 
 /**
  * Parameterized constructor with validation
  * Uses setters to ensure data validity
  */
-Product::Product(const std::string& sku, const std::string& name, 
-                 double price, int quantity, const std::string& category)
-    : sku(sku), name(name), category(category) {
+Product::Product(ProductType type, const std::string& sku, const std::string& name, 
+                 Money price, int quantity, const std::string& category)
+    : sku(sku), name(name), category(category), type(type) {
     // Use setters for validation
-    this->price = (price >= 0) ? price : 0.0;
+    this->price = price.isNegative() ? Money() : price;
     this->quantity = (quantity >= 0) ? quantity : 0;
 }
 
@@ -41,15 +42,15 @@ Product::~Product() {
 
 // ==================== GETTERS ====================
 
-std::string Product::getSku() const {
+const std::string& Product::getSku() const {
     return sku;
 }
 
-std::string Product::getName() const {
+const std::string& Product::getName() const {
     return name;
 }
 
-double Product::getPrice() const {
+Money Product::getPrice() const {
     return price;
 }
 
@@ -57,10 +58,14 @@ int Product::getQuantity() const {
     return quantity;
 }
 
-std::string Product::getCategory() const {
+const std::string& Product::getCategory() const {
     return category;
 }
 
+ProductType Product::getTypeTag() const {
+    return type;
+}
+
 // ==================== SETTERS ====================
 
 void Product::setSku(const std::string& sku) {
@@ -75,8 +80,8 @@ void Product::setName(const std::string& name) {
  * Sets price with validation
  * @return false if price is negative (invalid)
  */
-bool Product::setPrice(double price) {
-    if (price < 0) {
+bool Product::setPrice(Money price) {
+    if (price.isNegative()) {
         return false;
     }
     this->price = price;
@@ -105,7 +110,7 @@ void Product::setCategory(const std::string& category) {
  * Calculates the total inventory value for this product
  * Can be overridden by derived classes for special calculations
  */
-double Product::calculateValue() const {
+Money Product::calculateValue() const {
     return price * quantity;
 }
 
@@ -114,11 +119,11 @@ double Product::calculateValue() const {
  * @param percentage Value between 0-100
  * @return The discounted price (does not modify the actual price)
  */
-double Product::applyDiscount(double percentage) const {
+Money Product::applyDiscount(double percentage) const {
     if (percentage < 0 || percentage > 100) {
         return price;  // Invalid percentage, return original price
     }
-    return price * (1 - percentage / 100.0);
+    return price.percentOf(100.0 - percentage);
 }
 
 /**
@@ -128,7 +133,7 @@ double Product::applyDiscount(double percentage) const {
  */
 std::string Product::toCSV() const {
     return sku + "," + name + "," + 
-           std::to_string(price) + "," + 
+           price.toString() + "," + 
            std::to_string(quantity) + "," + 
            category;
 }
@@ -149,3 +154,30 @@ void Product::displayHeader() {
               << std::endl;
     std::cout << std::string(100, '-') << std::endl;
 }
+
+/**
+ * Parses a product type name without allocating
+ * Comparison is case-insensitive to match the search menu behavior
+ */
+bool Product::parseType(const std::string& text, ProductType& type) {
+    auto equalsIgnoreCase = [&text](const char* word) {
+        size_t i = 0;
+        for (; word[i] != '\0'; ++i) {
+            if (i >= text.size() ||
+                std::tolower(static_cast<unsigned char>(text[i])) != word[i]) {
+                return false;
+            }
+        }
+        return i == text.size();
+    };
+
+    if (equalsIgnoreCase("physical")) {
+        type = ProductType::Physical;
+        return true;
+    }
+    if (equalsIgnoreCase("digital")) {
+        type = ProductType::Digital;
+        return true;
+    }
+    return false;
+}
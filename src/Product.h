@@ -15,6 +15,24 @@
 #include <string>
 #include <iostream>
 #include <iomanip>
+#include <cstdint>
+#include <cstddef>
+#include "Money.h"
+
+/**
+ * @enum ProductType
+ * @brief Compact tag identifying the concrete product class
+ *
+ * Stored directly in every Product so type checks and per-type counts
+ * never need to build the string returned by getType().
+ */
+enum class ProductType : std::uint8_t {
+    Physical = 0,
+    Digital = 1
+};
+
+/// Number of ProductType values (for per-type arrays)
+const std::size_t PRODUCT_TYPE_COUNT = 2;
 
 /**
  * @class Product
@@ -23,32 +41,36 @@
  * The Product class encapsulates common attributes shared by all products:
  * SKU (Stock Keeping Unit), name, price, and quantity. It provides virtual
  * functions that derived classes must implement for specialized behavior.
+ * Fields an Inventory indexes can only be changed through that Inventory.
  */
 class Product {
 protected:
     std::string sku;        ///< Unique identifier for the product
     std::string name;       ///< Product name/description
-    double price;           ///< Unit price in dollars
+    Money price;            ///< Unit price (exact cents)
     int quantity;           ///< Current stock quantity
     std::string category;   ///< Product category/type
+    ProductType type;       ///< Concrete product type tag
 
 public:
     /**
      * @brief Default constructor
      * Initializes a product with empty/zero values
+     * @param type Concrete product type tag
      */
-    Product();
+    explicit Product(ProductType type);
 
     /**
      * @brief Parameterized constructor
+     * @param type Concrete product type tag
      * @param sku Unique stock keeping unit identifier
      * @param name Product name
      * @param price Unit price (must be >= 0)
      * @param quantity Stock quantity (must be >= 0)
      * @param category Product category
      */
-    Product(const std::string& sku, const std::string& name, 
-            double price, int quantity, const std::string& category);
+    Product(ProductType type, const std::string& sku, const std::string& name, 
+            Money price, int quantity, const std::string& category);
 
     /**
      * @brief Virtual destructor for proper cleanup in derived classes
@@ -59,21 +81,21 @@ public:
     
     /**
      * @brief Get the product SKU
-     * @return String containing the SKU
+     * @return Reference to the SKU (valid while the product exists)
      */
-    std::string getSku() const;
+    const std::string& getSku() const;
 
     /**
      * @brief Get the product name
-     * @return String containing the product name
+     * @return Reference to the product name
      */
-    std::string getName() const;
+    const std::string& getName() const;
 
     /**
      * @brief Get the unit price
-     * @return Double representing the price
+     * @return Exact unit price
      */
-    double getPrice() const;
+    Money getPrice() const;
 
     /**
      * @brief Get the current quantity
@@ -83,12 +105,25 @@ public:
 
     /**
      * @brief Get the product category
-     * @return String containing the category
+     * @return Reference to the category
+     */
+    const std::string& getCategory() const;
+
+    /**
+     * @brief Get the compact product type tag
+     * @return ProductType of the concrete class
      */
-    std::string getCategory() const;
+    ProductType getTypeTag() const;
 
+private:
     // ==================== SETTERS ====================
-    
+    // Inventory mirrors these fields in its hot columns and indexes, so
+    // only it may change them (see Inventory::setPrice and friends); a
+    // caller still holding the pointer it passed to addProduct cannot
+    // bypass them.
+
+    friend class Inventory;
+
     /**
      * @brief Set the product SKU
      * @param sku New SKU value
@@ -106,7 +141,7 @@ public:
      * @param price New price (must be >= 0)
      * @return true if price was set, false if invalid
      */
-    bool setPrice(double price);
+    bool setPrice(Money price);
 
     /**
      * @brief Set the quantity
@@ -121,6 +156,7 @@ public:
      */
     void setCategory(const std::string& category);
 
+public:
     // ==================== VIRTUAL FUNCTIONS ====================
     
     /**
@@ -131,16 +167,16 @@ public:
 
     /**
      * @brief Virtual function to calculate total value (price * quantity)
-     * @return Double representing total inventory value of this product
+     * @return Exact total inventory value of this product
      */
-    virtual double calculateValue() const;
+    virtual Money calculateValue() const;
 
     /**
      * @brief Virtual function to apply a discount to the product
      * @param percentage Discount percentage (0-100)
-     * @return Discounted price
+     * @return Discounted price, rounded to the nearest cent
      */
-    virtual double applyDiscount(double percentage) const;
+    virtual Money applyDiscount(double percentage) const;
 
     /**
      * @brief Pure virtual function to get the product type as string
@@ -158,6 +194,14 @@ public:
      * @brief Display a formatted header for product listings
      */
     static void displayHeader();
+
+    /**
+     * @brief Parse a type name ("Physical"/"Digital", any case)
+     * @param text Type name to parse
+     * @param type Receives the parsed tag on success
+     * @return true if text named a known product type
+     */
+    static bool parseType(const std::string& text, ProductType& type);
 };
 
 #endif // PRODUCT_H
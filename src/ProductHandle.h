@@ -0,0 +1,48 @@
+/**
+ * @file ProductHandle.h
+ * @brief Generational product handle for SmallBiz Inventory System
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * This file defines ProductHandle, a compact reference to a product slot
+ * inside an Inventory. Unlike a raw Product pointer, a handle can be kept
+ * across removals and reloads: once its product is deleted, the slot's
+ * generation changes and the handle simply stops resolving.
+ */
+
+#ifndef PRODUCTHANDLE_H
+#define PRODUCTHANDLE_H
+
+#include <cstdint>
+
+/**
+ * @struct ProductHandle
+ * @brief Slot index + generation pair identifying one product
+ *
+ * Handles are issued by Inventory and resolved with Inventory::resolve().
+ * Generation 0 is never issued, so a default-constructed handle is null.
+ */
+struct ProductHandle {
+    std::uint32_t index = 0;       ///< Slot index inside the inventory
+    std::uint32_t generation = 0;  ///< Slot generation when the handle was issued
+
+    /**
+     * @brief Check whether this is the null handle
+     * @return true if the handle was never issued
+     */
+    bool isNull() const {
+        return generation == 0;
+    }
+
+    bool operator==(const ProductHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+
+    bool operator!=(const ProductHandle& other) const {
+        return !(*this == other);
+    }
+};
+
+static_assert(sizeof(ProductHandle) == 8, "ProductHandle should stay 8 bytes");
+
+#endif // PRODUCTHANDLE_H
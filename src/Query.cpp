@@ -0,0 +1,409 @@
+/**
+ * @file Query.cpp
+ * @brief Implementation of the composable product query
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * Case-insensitive test strings are lower-cased once when the query is
+ * built, so evaluating a node never allocates.
+ */
+
+#include "Query.h"
+#include "PhysicalProduct.h"
+#include "DigitalProduct.h"
+#include "StringUtils.h"
+#include <charconv>
+#include <climits>
+#include <limits>
+#include <sstream>
+#include <utility>
+
+// ==================== NODE ====================
+
+/**
+ * @struct Query::Node
+ * @brief One node of the predicate tree
+ */
+struct Query::Node {
+    Kind kind = Kind::Everything;
+    std::string text;
+    std::int64_t low = 0;
+    std::int64_t high = 0;
+    double lowMeasure = 0.0;
+    double highMeasure = 0.0;
+    ProductType type = ProductType::Physical;
+    std::vector<Query> children;
+};
+
+// ==================== CONSTRUCTORS ====================
+
+Query::Query() : node(std::make_shared<Node>()) {
+}
+
+Query::Query(std::shared_ptr<const Node> node) : node(std::move(node)) {
+}
+
+Query Query::leaf(Kind kind, const std::string& text) {
+    auto result = std::make_shared<Node>();
+    result->kind = kind;
+    result->text = (kind == Kind::SkuEquals || kind == Kind::SkuPrefix) ? text : toLowerCopy(text);
+    return Query(result);
+}
+
+Query Query::range(Kind kind, std::int64_t low, std::int64_t high) {
+    auto result = std::make_shared<Node>();
+    result->kind = kind;
+    result->low = low;
+    result->high = high;
+    return Query(result);
+}
+
+Query Query::measureRange(Kind kind, double low, double high) {
+    auto result = std::make_shared<Node>();
+    result->kind = kind;
+    result->lowMeasure = low;
+    result->highMeasure = high;
+    return Query(result);
+}
+
+/**
+ * Nested nodes of the same kind are flattened, so a && b && c is one
+ * And node with three children
+ */
+Query Query::combine(Kind kind, const std::vector<Query>& queries) {
+    auto result = std::make_shared<Node>();
+    result->kind = kind;
+    for (const Query& query : queries) {
+        if (query.kind() == kind) {
+            result->children.insert(result->children.end(),
+                                    query.children().begin(), query.children().end());
+        } else {
+            result->children.push_back(query);
+        }
+    }
+    return Query(result);
+}
+
+// ==================== LEAF PREDICATES ====================
+
+Query Query::everything() {
+    return Query();
+}
+
+Query Query::sku(const std::string& sku) {
+    return leaf(Kind::SkuEquals, sku);
+}
+
+Query Query::skuPrefix(const std::string& prefix) {
+    return leaf(Kind::SkuPrefix, prefix);
+}
+
+Query Query::nameContains(const std::string& text) {
+    return leaf(Kind::NameContains, text);
+}
+
+Query Query::category(const std::string& category) {
+    return leaf(Kind::CategoryEquals, category);
+}
+
+Query Query::categoryContains(const std::string& text) {
+    return leaf(Kind::CategoryContains, text);
+}
+
+Query Query::type(ProductType type) {
+    auto result = std::make_shared<Node>();
+    result->kind = Kind::TypeIs;
+    result->type = type;
+    return Query(result);
+}
+
+Query Query::priceBetween(Money low, Money high) {
+    return range(Kind::PriceRange, low.getCents(), high.getCents());
+}
+
+Query Query::priceBelow(Money limit) {
+    return range(Kind::PriceRange, std::numeric_limits<std::int64_t>::min(), limit.getCents() - 1);
+}
+
+Query Query::quantityBetween(int low, int high) {
+    return range(Kind::QuantityRange, low, high);
+}
+
+Query Query::quantityBelow(int limit) {
+    return range(Kind::QuantityRange, std::numeric_limits<int>::min(),
+                 static_cast<std::int64_t>(limit) - 1);
+}
+
+Query Query::supplier(const std::string& supplier) {
+    return leaf(Kind::SupplierEquals, supplier);
+}
+
+Query Query::licenseType(const std::string& licenseType) {
+    return leaf(Kind::LicenseEquals, licenseType);
+}
+
+Query Query::weightBetween(double low, double high) {
+    return measureRange(Kind::WeightRange, low, high);
+}
+
+Query Query::fileSizeBetween(double low, double high) {
+    return measureRange(Kind::FileSizeRange, low, high);
+}
+
+Query Query::downloadLinkContains(const std::string& text) {
+    return leaf(Kind::DownloadLinkContains, text);
+}
+
+// ==================== COMBINATORS ====================
+
+Query Query::allOf(const std::vector<Query>& queries) {
+    return combine(Kind::And, queries);
+}
+
+Query Query::anyOf(const std::vector<Query>& queries) {
+    return combine(Kind::Or, queries);
+}
+
+Query Query::negate(const Query& query) {
+    auto result = std::make_shared<Node>();
+    result->kind = Kind::Not;
+    result->children.push_back(query);
+    return Query(result);
+}
+
+Query operator&&(const Query& a, const Query& b) {
+    return Query::allOf({a, b});
+}
+
+Query operator||(const Query& a, const Query& b) {
+    return Query::anyOf({a, b});
+}
+
+Query operator!(const Query& a) {
+    return Query::negate(a);
+}
+
+// ==================== INSPECTION ====================
+
+Query::Kind Query::kind() const {
+    return node->kind;
+}
+
+const std::string& Query::text() const {
+    return node->text;
+}
+
+std::int64_t Query::low() const {
+    return node->low;
+}
+
+std::int64_t Query::high() const {
+    return node->high;
+}
+
+double Query::lowMeasure() const {
+    return node->lowMeasure;
+}
+
+double Query::highMeasure() const {
+    return node->highMeasure;
+}
+
+ProductType Query::productType() const {
+    return node->type;
+}
+
+const std::vector<Query>& Query::children() const {
+    return node->children;
+}
+
+bool Query::matches(const Product& product) const {
+    switch (node->kind) {
+        case Kind::Everything:
+            return true;
+        case Kind::SkuEquals:
+            return product.getSku() == node->text;
+        case Kind::SkuPrefix:
+            return product.getSku().compare(0, node->text.size(), node->text) == 0;
+        case Kind::NameContains:
+            return containsIgnoreCase(product.getName(), node->text);
+        case Kind::CategoryEquals:
+            return equalsIgnoreCase(product.getCategory(), node->text);
+        case Kind::CategoryContains:
+            return containsIgnoreCase(product.getCategory(), node->text);
+        case Kind::TypeIs:
+            return product.getTypeTag() == node->type;
+        case Kind::PriceRange: {
+            std::int64_t cents = product.getPrice().getCents();
+            return cents >= node->low && cents <= node->high;
+        }
+        case Kind::QuantityRange:
+            return product.getQuantity() >= node->low && product.getQuantity() <= node->high;
+        case Kind::SupplierEquals:
+            return product.getTypeTag() == ProductType::Physical &&
+                   equalsIgnoreCase(static_cast<const PhysicalProduct&>(product).getSupplier(), node->text);
+        case Kind::LicenseEquals:
+            return product.getTypeTag() == ProductType::Digital &&
+                   equalsIgnoreCase(static_cast<const DigitalProduct&>(product).getLicenseType(), node->text);
+        case Kind::WeightRange: {
+            if (product.getTypeTag() != ProductType::Physical) {
+                return false;
+            }
+            double weight = static_cast<const PhysicalProduct&>(product).getWeight();
+            return weight >= node->lowMeasure && weight <= node->highMeasure;
+        }
+        case Kind::FileSizeRange: {
+            if (product.getTypeTag() != ProductType::Digital) {
+                return false;
+            }
+            double size = static_cast<const DigitalProduct&>(product).getFileSizeMB();
+            return size >= node->lowMeasure && size <= node->highMeasure;
+        }
+        case Kind::DownloadLinkContains:
+            return product.getTypeTag() == ProductType::Digital &&
+                   containsIgnoreCase(static_cast<const DigitalProduct&>(product).getDownloadLink(), node->text);
+        case Kind::And:
+            for (const Query& child : node->children) {
+                if (!child.matches(product)) {
+                    return false;
+                }
+            }
+            return true;
+        case Kind::Or:
+            for (const Query& child : node->children) {
+                if (child.matches(product)) {
+                    return true;
+                }
+            }
+            return false;
+        case Kind::Not:
+            return !node->children.front().matches(product);
+    }
+    return false;
+}
+
+const char* accessPathName(AccessPath access) {
+    switch (access) {
+        case AccessPath::FullScan:
+            return "full scan";
+        case AccessPath::SkuLookup:
+            return "SKU hash lookup";
+        case AccessPath::SkuRange:
+            return "ordered SKU index";
+        case AccessPath::BitmapIndex:
+            return "bitmap index";
+        case AccessPath::NameIndex:
+            return "name trigram index";
+        case AccessPath::PriceIndex:
+            return "price index";
+        case AccessPath::QuantityIndex:
+            return "quantity index";
+        case AccessPath::ColumnScan:
+            return "vectorized column scan";
+    }
+    return "unknown";
+}
+
+/**
+ * Quotes a test string, escaping quotes and backslashes so no text can
+ * read as query syntax
+ */
+static std::string quoted(const std::string& text) {
+    std::string result = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result + "\"";
+}
+
+/**
+ * Shortest text that reads back as the same double (12.5, not 12.500000)
+ */
+static std::string measure(double value) {
+    char buffer[32];
+    std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    return std::string(buffer, result.ptr);
+}
+
+/**
+ * Distinct queries always render differently, so the text can key cached
+ * results
+ */
+std::string Query::toString() const {
+    std::ostringstream out;
+    switch (node->kind) {
+        case Kind::Everything:
+            out << "everything";
+            break;
+        case Kind::SkuEquals:
+            out << "sku = " << quoted(node->text);
+            break;
+        case Kind::SkuPrefix:
+            out << "sku starts with " << quoted(node->text);
+            break;
+        case Kind::NameContains:
+            out << "name contains " << quoted(node->text);
+            break;
+        case Kind::CategoryEquals:
+            out << "category = " << quoted(node->text);
+            break;
+        case Kind::CategoryContains:
+            out << "category contains " << quoted(node->text);
+            break;
+        case Kind::TypeIs:
+            out << "type = " << (node->type == ProductType::Physical ? "Physical" : "Digital");
+            break;
+        case Kind::PriceRange:
+        case Kind::QuantityRange: {
+            // Prices print as dollars; an INT_MIN-or-lower bound is open
+            bool price = node->kind == Kind::PriceRange;
+            auto bound = [price](std::int64_t value) {
+                return price ? Money::fromCents(value).toString() : std::to_string(value);
+            };
+            out << (price ? "price" : "quantity");
+            if (node->low <= INT_MIN) {
+                out << " <= " << bound(node->high);
+            } else {
+                out << " in [" << bound(node->low) << ", " << bound(node->high) << "]";
+            }
+            break;
+        }
+        case Kind::SupplierEquals:
+            out << "supplier = " << quoted(node->text);
+            break;
+        case Kind::LicenseEquals:
+            out << "license = " << quoted(node->text);
+            break;
+        case Kind::WeightRange:
+            out << "weight in [" << measure(node->lowMeasure) << ", " << measure(node->highMeasure) << "] lbs";
+            break;
+        case Kind::FileSizeRange:
+            out << "file size in [" << measure(node->lowMeasure) << ", " << measure(node->highMeasure) << "] MB";
+            break;
+        case Kind::DownloadLinkContains:
+            out << "download link contains " << quoted(node->text);
+            break;
+        case Kind::And:
+        case Kind::Or:
+            if (node->children.empty()) {
+                out << (node->kind == Kind::And ? "everything" : "nothing");
+                break;
+            }
+            out << "(";
+            for (size_t i = 0; i < node->children.size(); ++i) {
+                if (i > 0) {
+                    out << (node->kind == Kind::And ? " AND " : " OR ");
+                }
+                out << node->children[i].toString();
+            }
+            out << ")";
+            break;
+        case Kind::Not:
+            out << "NOT " << node->children.front().toString();
+            break;
+    }
+    return out.str();
+}
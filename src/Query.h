@@ -0,0 +1,268 @@
+/**
+ * @file Query.h
+ * @brief Composable product query for SmallBiz Inventory System
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * This file defines Query, an immutable predicate tree over product
+ * fields. Leaf predicates are combined with &&, || and ! so a search such
+ * as "Software under $50 whose name contains 'pro'" is a single object
+ * that Inventory can run in one pass, using an index when one applies.
+ */
+
+#ifndef QUERY_H
+#define QUERY_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Product.h"
+#include "Money.h"
+
+/**
+ * @class Query
+ * @brief Predicate over a product, built from leaf tests and combinators
+ *
+ * Queries are cheap to copy: the tree is shared and never modified.
+ * String tests ignore case except the SKU tests, which are exact like
+ * SKU lookups elsewhere. Range bounds are inclusive.
+ */
+class Query {
+public:
+    /**
+     * @enum Kind
+     * @brief Node type of the predicate tree
+     */
+    enum class Kind {
+        Everything,        ///< Matches every product
+        SkuEquals,         ///< SKU equals text
+        SkuPrefix,         ///< SKU starts with text
+        NameContains,      ///< Name contains text
+        CategoryEquals,    ///< Category equals text
+        CategoryContains,  ///< Category contains text
+        TypeIs,            ///< Product type equals productType()
+        PriceRange,        ///< Price in cents within [low(), high()]
+        QuantityRange,     ///< Quantity within [low(), high()]
+        SupplierEquals,    ///< Physical product whose supplier equals text
+        LicenseEquals,     ///< Digital product whose license type equals text
+        WeightRange,       ///< Physical product weighing within [lowMeasure(), highMeasure()] lbs
+        FileSizeRange,     ///< Digital product whose file size is within [lowMeasure(), highMeasure()] MB
+        DownloadLinkContains, ///< Digital product whose download link contains text
+        And,               ///< Every child matches
+        Or,                ///< At least one child matches
+        Not                ///< The single child does not match
+    };
+
+    /**
+     * @brief Default constructor - a query matching every product
+     */
+    Query();
+
+    // ==================== LEAF PREDICATES ====================
+
+    /**
+     * @brief Match every product
+     */
+    static Query everything();
+
+    /**
+     * @brief Match the product with exactly this SKU
+     * @param sku SKU (case-sensitive)
+     */
+    static Query sku(const std::string& sku);
+
+    /**
+     * @brief Match SKUs starting with a prefix
+     * @param prefix SKU prefix (case-sensitive)
+     */
+    static Query skuPrefix(const std::string& prefix);
+
+    /**
+     * @brief Match names containing a substring
+     * @param text Substring (case-insensitive)
+     */
+    static Query nameContains(const std::string& text);
+
+    /**
+     * @brief Match one category exactly
+     * @param category Category name (case-insensitive)
+     */
+    static Query category(const std::string& category);
+
+    /**
+     * @brief Match categories containing a substring
+     * @param text Substring (case-insensitive)
+     */
+    static Query categoryContains(const std::string& text);
+
+    /**
+     * @brief Match one product type
+     * @param type Physical or Digital
+     */
+    static Query type(ProductType type);
+
+    /**
+     * @brief Match unit prices within [low, high]
+     * @param low Lowest price included
+     * @param high Highest price included
+     */
+    static Query priceBetween(Money low, Money high);
+
+    /**
+     * @brief Match unit prices strictly below a limit
+     * @param limit Price limit (excluded)
+     */
+    static Query priceBelow(Money limit);
+
+    /**
+     * @brief Match quantities within [low, high]
+     * @param low Lowest quantity included
+     * @param high Highest quantity included
+     */
+    static Query quantityBetween(int low, int high);
+
+    /**
+     * @brief Match quantities strictly below a limit
+     * @param limit Quantity limit (excluded)
+     */
+    static Query quantityBelow(int limit);
+
+    /**
+     * @brief Match physical products from one supplier
+     * @param supplier Supplier name (case-insensitive)
+     */
+    static Query supplier(const std::string& supplier);
+
+    /**
+     * @brief Match digital products with one license type
+     * @param licenseType License type (case-insensitive)
+     */
+    static Query licenseType(const std::string& licenseType);
+
+    /**
+     * @brief Match physical products weighing within [low, high]
+     * @param low Lowest weight included (lbs)
+     * @param high Highest weight included (lbs)
+     */
+    static Query weightBetween(double low, double high);
+
+    /**
+     * @brief Match digital products whose file size is within [low, high]
+     * @param low Smallest size included (MB)
+     * @param high Largest size included (MB)
+     */
+    static Query fileSizeBetween(double low, double high);
+
+    /**
+     * @brief Match digital products whose download link contains a substring
+     * @param text Substring (case-insensitive)
+     */
+    static Query downloadLinkContains(const std::string& text);
+
+    // ==================== COMBINATORS ====================
+
+    /**
+     * @brief Match products satisfying every query
+     * @param queries Queries to combine (none = everything)
+     * @return Conjunction
+     */
+    static Query allOf(const std::vector<Query>& queries);
+
+    /**
+     * @brief Match products satisfying at least one query
+     * @param queries Queries to combine (none = nothing)
+     * @return Disjunction
+     */
+    static Query anyOf(const std::vector<Query>& queries);
+
+    /**
+     * @brief Match products that do not satisfy a query
+     * @param query Query to negate
+     * @return Negation
+     */
+    static Query negate(const Query& query);
+
+    // ==================== INSPECTION ====================
+
+    Kind kind() const;
+    const std::string& text() const;          ///< Test string (lower-cased unless a SKU test)
+    std::int64_t low() const;                 ///< Lower bound of a range test
+    std::int64_t high() const;                ///< Upper bound of a range test
+    double lowMeasure() const;                ///< Lower bound of a weight or file size test
+    double highMeasure() const;               ///< Upper bound of a weight or file size test
+    ProductType productType() const;          ///< Type of a TypeIs test
+    const std::vector<Query>& children() const; ///< Operands of And/Or/Not
+
+    /**
+     * @brief Evaluate the query against one product
+     * @param product Product to test
+     * @return true if the product matches
+     */
+    bool matches(const Product& product) const;
+
+    /**
+     * @brief Render the query as readable text, e.g. for explain output
+     * Queries that differ render differently (strings are escaped and
+     * weights printed exactly), so the text can also key cached results.
+     * @return Description such as (category = "software" AND price <= 49.99)
+     */
+    std::string toString() const;
+
+private:
+    struct Node;
+    std::shared_ptr<const Node> node;   ///< Shared immutable tree
+
+    explicit Query(std::shared_ptr<const Node> node);
+    static Query leaf(Kind kind, const std::string& text);
+    static Query range(Kind kind, std::int64_t low, std::int64_t high);
+    static Query measureRange(Kind kind, double low, double high);
+    static Query combine(Kind kind, const std::vector<Query>& queries);
+};
+
+/// Conjunction shorthand: a && b
+Query operator&&(const Query& a, const Query& b);
+
+/// Disjunction shorthand: a || b
+Query operator||(const Query& a, const Query& b);
+
+/// Negation shorthand: !a
+Query operator!(const Query& a);
+
+/**
+ * @enum AccessPath
+ * @brief How the candidate products of a query are found
+ */
+enum class AccessPath {
+    FullScan,        ///< Walk every product in display order
+    SkuLookup,       ///< Hash lookup of one SKU
+    SkuRange,        ///< Prefix scan of the ordered SKU index
+    BitmapIndex,     ///< Type/category/supplier/license bitmaps
+    NameIndex,       ///< Trigram candidates for a name substring
+    PriceIndex,      ///< Range scan of the price-ordered index
+    QuantityIndex,   ///< Range scan of the quantity-ordered index
+    ColumnScan       ///< Vectorized filter over the price or quantity column
+};
+
+/**
+ * @brief Get a display name for an access path
+ * @param access Access path
+ * @return Name such as "bitmap index"
+ */
+const char* accessPathName(AccessPath access);
+
+/**
+ * @struct QueryPlan
+ * @brief Access path chosen for a query with its cost estimates
+ *
+ * Costs are relative: checking one product during a full scan costs 1.
+ */
+struct QueryPlan {
+    AccessPath access = AccessPath::FullScan;  ///< How candidates are found
+    Query driver;                              ///< Leaf the index answers (everything for scans)
+    double estimatedCandidates = 0.0;          ///< Products the access path yields
+    double estimatedRows = 0.0;                ///< Products expected to match the whole query
+    double estimatedCost = 0.0;                ///< Relative cost of the plan
+};
+
+#endif // QUERY_H
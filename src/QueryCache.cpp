@@ -0,0 +1,152 @@
+/**
+ * @file QueryCache.cpp
+ * @brief Implementation of the query result cache
+ * @author Ethan Trent
+ * @date 2025
+ */
+
+#include "QueryCache.h"
+#include "StringUtils.h"
+#include <iterator>
+#include <utility>
+
+double QueryCacheStats::hitRate() const {
+    std::size_t lookups = hits + misses;
+    return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+}
+
+QueryCache::QueryCache(std::size_t capacity)
+    : capacity(capacity) {
+}
+
+/**
+ * A field changed after the entry was stored if its epoch is newer
+ */
+bool QueryCache::isStale(const Entry& entry) const {
+    for (std::size_t bit = 0; bit < FIELD_BITS; ++bit) {
+        if ((entry.fields >> bit) & 1u) {
+            if (fieldEpochs[bit] > entry.epoch) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * Case-insensitive keys hash their lower-cased characters, so keys that
+ * compare equal hash equally without building a lower-cased copy
+ */
+std::uint64_t QueryCache::hashKey(const QueryKey& key) {
+    std::uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](unsigned char byte) {
+        hash ^= byte;
+        hash *= 1099511628211ull;
+    };
+    for (std::size_t shift = 0; shift < 32; shift += 8) {
+        mix(static_cast<unsigned char>(key.scope >> shift));
+    }
+    mix(key.ignoreCase ? 1 : 0);
+    for (char c : key.text) {
+        mix(static_cast<unsigned char>(key.ignoreCase ? toLowerAscii(c) : c));
+    }
+    return hash;
+}
+
+bool QueryCache::sameKey(const Entry& entry, const QueryKey& key) {
+    if (entry.scope != key.scope || entry.ignoreCase != key.ignoreCase) {
+        return false;
+    }
+    return key.ignoreCase ? equalsIgnoreCase(entry.text, key.text) : entry.text == key.text;
+}
+
+void QueryCache::erase(std::list<Entry>::iterator entry) {
+    lookupTable.erase(entry->hash);
+    entries.erase(entry);
+}
+
+const std::vector<ProductHandle>* QueryCache::find(const QueryKey& key) {
+    auto it = lookupTable.find(hashKey(key));
+    if (it == lookupTable.end() || !sameKey(*it->second, key)) {
+        stats.misses++;
+        return nullptr;
+    }
+    if (isStale(*it->second)) {
+        erase(it->second);
+        stats.misses++;
+        stats.stale++;
+        return nullptr;
+    }
+    // Move to the front without copying the entry
+    entries.splice(entries.begin(), entries, it->second);
+    stats.hits++;
+    return &it->second->results;
+}
+
+bool QueryCache::lookup(const QueryKey& key, std::vector<ProductHandle>& results) {
+    const std::vector<ProductHandle>* cached = find(key);
+    if (cached == nullptr) {
+        return false;
+    }
+    results = *cached;
+    return true;
+}
+
+/**
+ * An entry already under the same hash is replaced, whatever its key
+ */
+const std::vector<ProductHandle>* QueryCache::store(const QueryKey& key, unsigned fields,
+                                                    std::vector<ProductHandle> results) {
+    if (capacity == 0) {
+        return nullptr;
+    }
+    const std::uint64_t hash = hashKey(key);
+    auto it = lookupTable.find(hash);
+    if (it != lookupTable.end()) {
+        erase(it->second);
+    }
+    while (entries.size() >= capacity) {
+        erase(std::prev(entries.end()));
+        stats.evictions++;
+    }
+    entries.push_front(Entry{key.scope, key.ignoreCase, std::string(key.text), hash, fields, clock,
+                             std::move(results)});
+    lookupTable.emplace(hash, entries.begin());
+    return &entries.front().results;
+}
+
+/**
+ * Only the epochs move; stale entries are dropped lazily by lookup
+ */
+void QueryCache::invalidate(unsigned fields) {
+    clock++;
+    for (std::size_t bit = 0; bit < FIELD_BITS; ++bit) {
+        if ((fields >> bit) & 1u) {
+            fieldEpochs[bit] = clock;
+        }
+    }
+}
+
+void QueryCache::clear() {
+    entries.clear();
+    lookupTable.clear();
+}
+
+void QueryCache::setCapacity(std::size_t capacity) {
+    this->capacity = capacity;
+    while (entries.size() > capacity) {
+        erase(std::prev(entries.end()));
+        stats.evictions++;
+    }
+}
+
+QueryCacheStats QueryCache::getStats() const {
+    QueryCacheStats result = stats;
+    result.entries = entries.size();
+    result.capacity = capacity;
+    return result;
+}
+
+void QueryCache::resetStats() {
+    stats = QueryCacheStats();
+}
@@ -0,0 +1,190 @@
+/**
+ * @file QueryCache.h
+ * @brief LRU cache of search results for SmallBiz Inventory System
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * This file defines QueryCache, a bounded least-recently-used cache from a
+ * query key to the handles it returned. Keys are looked up by hash from a
+ * view of the caller's text, so a hit never builds a string. Each entry records
+ * which product fields its result depends on; a mutation bumps the epoch
+ * of the fields it touched, and entries older than any of their fields'
+ * epochs are treated as misses.
+ */
+
+#ifndef QUERYCACHE_H
+#define QUERYCACHE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "ProductHandle.h"
+
+/**
+ * @struct QueryCacheStats
+ * @brief Counters describing how well the query cache is doing
+ */
+struct QueryCacheStats {
+    std::size_t hits = 0;          ///< Lookups answered from the cache
+    std::size_t misses = 0;        ///< Lookups that had to run the search
+    std::size_t stale = 0;         ///< Misses caused by an invalidated entry
+    std::size_t evictions = 0;     ///< Entries dropped to stay within capacity
+    std::size_t entries = 0;       ///< Entries currently cached
+    std::size_t capacity = 0;      ///< Maximum entries (0 = caching disabled)
+
+    /**
+     * @brief Fraction of lookups answered from the cache
+     * @return Hit rate in [0, 1] (0 before the first lookup)
+     */
+    double hitRate() const;
+};
+
+/**
+ * @struct QueryKey
+ * @brief Identifies a cached query without owning its text
+ *
+ * The scope separates kinds of query chosen by the owner (e.g. name and
+ * category searches), so equal text in two scopes never collides.
+ */
+struct QueryKey {
+    unsigned scope = 0;          ///< Owner-defined kind of query
+    std::string_view text;       ///< Query text (only read during the call)
+    bool ignoreCase = false;     ///< Compare and hash text ignoring ASCII case
+};
+
+/**
+ * @class QueryCache
+ * @brief Bounded LRU map from normalized query to result handles
+ *
+ * Dependencies are a bit mask of up to 32 fields chosen by the owner.
+ * invalidate() is O(fields) and never walks the entries: a stale entry
+ * is only noticed, and dropped, the next time it is looked up.
+ *
+ * Entries are indexed by a 64-bit hash of the key and the stored key is
+ * compared on every hit, so a hash collision is a miss, never a wrong
+ * result. Lookups allocate nothing beyond copying the results out.
+ */
+class QueryCache {
+private:
+    static const std::size_t FIELD_BITS = 32;   ///< Bits in a dependency mask
+
+    /**
+     * @struct Entry
+     * @brief One cached result
+     */
+    struct Entry {
+        unsigned scope = 0;                   ///< Key scope
+        bool ignoreCase = false;              ///< Key text compared ignoring case
+        std::string text;                     ///< Key text
+        std::uint64_t hash = 0;               ///< hashKey of the key
+        unsigned fields = 0;                  ///< Fields the result depends on
+        std::uint64_t epoch = 0;              ///< Clock when the result was stored
+        std::vector<ProductHandle> results;   ///< Cached handles
+    };
+
+    std::list<Entry> entries;                 ///< Most recently used first
+    std::unordered_map<std::uint64_t, std::list<Entry>::iterator> lookupTable; ///< Key hash -> entry
+    std::array<std::uint64_t, FIELD_BITS> fieldEpochs{}; ///< Clock of each field's last change
+    std::uint64_t clock = 0;                  ///< Bumped by every invalidate()
+    std::size_t capacity;                     ///< Maximum entries
+    QueryCacheStats stats;                    ///< Hit/miss counters
+
+    /**
+     * @brief Check whether any of an entry's fields changed after it was stored
+     * @param entry Cached entry
+     * @return true if the result may be out of date
+     */
+    bool isStale(const Entry& entry) const;
+
+    /**
+     * @brief Hash a key (FNV-1a over scope, case flag and text)
+     * @param key Key to hash
+     * @return 64-bit hash, equal for keys that compare equal
+     */
+    static std::uint64_t hashKey(const QueryKey& key);
+
+    /**
+     * @brief Check whether an entry was stored under a key
+     * @param entry Cached entry
+     * @param key Key being looked up
+     * @return true if scope, case flag and text all match
+     */
+    static bool sameKey(const Entry& entry, const QueryKey& key);
+
+    /**
+     * @brief Remove one entry from the list and the hash table
+     * @param entry Entry to drop
+     */
+    void erase(std::list<Entry>::iterator entry);
+
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Maximum entries kept (0 disables caching)
+     */
+    explicit QueryCache(std::size_t capacity = 64);
+
+    /**
+     * @brief Find a query's cached result without copying it, counting a hit or miss
+     * A hit moves the entry to the front of the LRU order.
+     * @param key Query key
+     * @return The cached handles, valid until the cache is next changed,
+     *         or nullptr on a miss
+     */
+    const std::vector<ProductHandle>* find(const QueryKey& key);
+
+    /**
+     * @brief Look up a query, counting a hit or miss
+     * Like find, but copies the handles out.
+     * @param key Query key
+     * @param results Receives the cached handles on a hit
+     * @return true on a hit
+     */
+    bool lookup(const QueryKey& key, std::vector<ProductHandle>& results);
+
+    /**
+     * @brief Cache a query's result, evicting the least recently used entry if full
+     * @param key Query key (its text is copied)
+     * @param fields Dependency mask: changes to any of these fields invalidate it
+     * @param results Handles to cache
+     * @return The stored handles, valid until the cache is next changed,
+     *         or nullptr if caching is disabled
+     */
+    const std::vector<ProductHandle>* store(const QueryKey& key, unsigned fields,
+                                            std::vector<ProductHandle> results);
+
+    /**
+     * @brief Mark fields as changed, invalidating every entry that depends on them
+     * @param fields Dependency mask of the changed fields
+     */
+    void invalidate(unsigned fields);
+
+    /**
+     * @brief Drop every entry (statistics are kept)
+     */
+    void clear();
+
+    /**
+     * @brief Change the capacity, evicting entries that no longer fit
+     * @param capacity Maximum entries (0 disables caching)
+     */
+    void setCapacity(std::size_t capacity);
+
+    /**
+     * @brief Get the hit/miss counters
+     * @return Statistics, including current size and capacity
+     */
+    QueryCacheStats getStats() const;
+
+    /**
+     * @brief Reset the hit/miss/eviction counters to zero
+     */
+    void resetStats();
+};
+
+#endif // QUERYCACHE_H
@@ -0,0 +1,61 @@
+/**
+ * @file RadixSort.cpp
+ * @brief Implementation of the LSD radix sort
+ * @author Ethan Trent
+ * @date 2025
+ */
+
+#include "RadixSort.h"
+#include <array>
+#include <cstddef>
+
+static const std::size_t DIGIT_BITS = 8;
+static const std::size_t DIGIT_VALUES = std::size_t(1) << DIGIT_BITS;
+static const std::size_t PASSES = 64 / DIGIT_BITS;
+
+/**
+ * Counts every digit of every key in one read of the input, then
+ * scatters between the input and a scratch buffer once per useful pass
+ */
+void radixSort(std::vector<std::uint64_t>& keys, std::vector<std::uint32_t>& values) {
+    const std::size_t count = keys.size();
+    if (count < 2) {
+        return;
+    }
+
+    std::vector<std::array<std::size_t, DIGIT_VALUES>> histograms(PASSES);
+    for (auto& histogram : histograms) {
+        histogram.fill(0);
+    }
+    for (std::uint64_t key : keys) {
+        for (std::size_t pass = 0; pass < PASSES; ++pass) {
+            histograms[pass][(key >> (pass * DIGIT_BITS)) & (DIGIT_VALUES - 1)]++;
+        }
+    }
+
+    std::vector<std::uint64_t> scratchKeys(count);
+    std::vector<std::uint32_t> scratchValues(count);
+    for (std::size_t pass = 0; pass < PASSES; ++pass) {
+        std::array<std::size_t, DIGIT_VALUES>& histogram = histograms[pass];
+        const std::size_t shift = pass * DIGIT_BITS;
+        // A pass where every key shares the digit would not move anything
+        if (histogram[(keys[0] >> shift) & (DIGIT_VALUES - 1)] == count) {
+            continue;
+        }
+
+        // Turn counts into each digit's first output position
+        std::size_t offset = 0;
+        for (std::size_t& bucket : histogram) {
+            std::size_t size = bucket;
+            bucket = offset;
+            offset += size;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            std::size_t target = histogram[(keys[i] >> shift) & (DIGIT_VALUES - 1)]++;
+            scratchKeys[target] = keys[i];
+            scratchValues[target] = values[i];
+        }
+        keys.swap(scratchKeys);
+        values.swap(scratchValues);
+    }
+}
@@ -0,0 +1,40 @@
+/**
+ * @file RadixSort.h
+ * @brief LSD radix sort for numeric sort keys in SmallBiz Inventory System
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * Sorting by price, quantity or value only needs an integer key per
+ * product, so large inventories are sorted by extracting (key, slot)
+ * pairs from the hot columns and radix sorting them in O(n) passes
+ * instead of running a comparison sort through virtual getters.
+ */
+
+#ifndef RADIXSORT_H
+#define RADIXSORT_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Map a signed integer to an unsigned key with the same order
+ * Flipping the sign bit moves negatives below zero; prices are integer
+ * cents, so money needs no floating-point transform.
+ * @param value Signed value
+ * @return Unsigned key, ascending in the same order as value
+ */
+inline std::uint64_t orderedKey(std::int64_t value) {
+    return static_cast<std::uint64_t>(value) ^ (std::uint64_t(1) << 63);
+}
+
+/**
+ * @brief Stable LSD radix sort of (key, value) pairs by ascending key
+ * Sorts one byte per pass and skips passes where every key has the
+ * same byte, so small keys such as quantities take few passes. Pairs
+ * with equal keys keep their input order.
+ * @param keys Sort keys (sorted in place)
+ * @param values Payload moved with each key; must be as long as keys
+ */
+void radixSort(std::vector<std::uint64_t>& keys, std::vector<std::uint32_t>& values);
+
+#endif // RADIXSORT_H
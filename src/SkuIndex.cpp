@@ -0,0 +1,162 @@
+/**
+ * @file SkuIndex.cpp
+ * @brief Implementation of the Robin Hood SKU hash index
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * Robin Hood insertion keeps probe sequences short by letting an entry
+ * that is far from its home bucket displace one that is closer to home.
+ * Lookups can stop as soon as they pass an entry closer to home than the
+ * key being searched for would be.
+ */
+
+#include "SkuIndex.h"
+#include <utility>
+
+// Smallest bucket array allocated on first insert
+static const size_t MIN_CAPACITY = 16;
+
+// ==================== CONSTRUCTOR ====================
+
+SkuIndex::SkuIndex() : count(0) {
+}
+
+// ==================== PRIVATE HELPERS ====================
+
+/**
+ * FNV-1a followed by the murmur3 finalizer so that SKUs sharing long
+ * prefixes (TOOL-101, TOOL-102...) still spread across the table
+ */
+std::uint32_t SkuIndex::hashKey(std::string_view key) {
+    std::uint32_t hash = 2166136261u;
+    for (char c : key) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 16777619u;
+    }
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+size_t SkuIndex::probeDistance(std::uint32_t hash, size_t position) const {
+    size_t mask = table.size() - 1;
+    return (position + table.size() - (hash & mask)) & mask;
+}
+
+size_t SkuIndex::findPosition(std::string_view key, std::uint32_t hash) const {
+    if (table.empty()) {
+        return 0;
+    }
+    size_t mask = table.size() - 1;
+    size_t position = hash & mask;
+    for (size_t distance = 0; ; ++distance) {
+        const Entry& entry = table[position];
+        if (entry.value == EMPTY || probeDistance(entry.hash, position) < distance) {
+            return table.size();  // Key would have been placed before here
+        }
+        if (entry.hash == hash && entry.key == key) {
+            return position;
+        }
+        position = (position + 1) & mask;
+    }
+}
+
+void SkuIndex::place(Entry entry) {
+    size_t mask = table.size() - 1;
+    size_t position = entry.hash & mask;
+    size_t distance = 0;
+    while (true) {
+        Entry& current = table[position];
+        if (current.value == EMPTY) {
+            current = entry;
+            ++count;
+            return;
+        }
+        // Robin Hood: the entry farther from home takes the bucket
+        size_t currentDistance = probeDistance(current.hash, position);
+        if (currentDistance < distance) {
+            std::swap(current, entry);
+            distance = currentDistance;
+        }
+        position = (position + 1) & mask;
+        ++distance;
+    }
+}
+
+void SkuIndex::rehash(size_t capacity) {
+    std::vector<Entry> old(capacity);
+    old.swap(table);
+    count = 0;
+    for (const Entry& entry : old) {
+        if (entry.value != EMPTY) {
+            place(entry);
+        }
+    }
+}
+
+// ==================== PUBLIC INTERFACE ====================
+
+bool SkuIndex::insert(std::string_view key, std::uint32_t value) {
+    std::uint32_t hash = hashKey(key);
+    if (findPosition(key, hash) != table.size()) {
+        return false;  // Already present
+    }
+    // Grow at 80% load
+    if ((count + 1) * 5 > table.size() * 4) {
+        rehash(table.empty() ? MIN_CAPACITY : table.size() * 2);
+    }
+    Entry entry;
+    entry.key = key;
+    entry.hash = hash;
+    entry.value = value;
+    place(entry);
+    return true;
+}
+
+bool SkuIndex::find(std::string_view key, std::uint32_t& value) const {
+    size_t position = findPosition(key, hashKey(key));
+    if (position == table.size()) {
+        return false;
+    }
+    value = table[position].value;
+    return true;
+}
+
+bool SkuIndex::contains(std::string_view key) const {
+    return findPosition(key, hashKey(key)) != table.size();
+}
+
+/**
+ * Backward-shift deletion: pull following displaced entries one bucket
+ * closer to home until an empty bucket or a home-positioned entry
+ */
+bool SkuIndex::erase(std::string_view key) {
+    size_t position = findPosition(key, hashKey(key));
+    if (position == table.size()) {
+        return false;
+    }
+    size_t mask = table.size() - 1;
+    size_t next = (position + 1) & mask;
+    while (table[next].value != EMPTY && probeDistance(table[next].hash, next) > 0) {
+        table[position] = table[next];
+        position = next;
+        next = (next + 1) & mask;
+    }
+    table[position] = Entry();
+    --count;
+    return true;
+}
+
+void SkuIndex::clear() {
+    for (Entry& entry : table) {
+        entry = Entry();
+    }
+    count = 0;
+}
+
+size_t SkuIndex::size() const {
+    return count;
+}
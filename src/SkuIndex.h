@@ -0,0 +1,129 @@
+/**
+ * @file SkuIndex.h
+ * @brief Open-addressing SKU hash index for SmallBiz Inventory System
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * This file defines SkuIndex, a flat Robin Hood hash table mapping SKUs to
+ * inventory slot indices. All entries live in one contiguous array, so a
+ * lookup is a hash plus a short linear probe instead of a tree walk.
+ */
+
+#ifndef SKUINDEX_H
+#define SKUINDEX_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class SkuIndex
+ * @brief Robin Hood open-addressing map from SKU to slot index
+ *
+ * Keys are string_views into the owning products' SKU strings, so the
+ * index never copies a SKU; the caller must erase a key before the string
+ * it views is destroyed. Capacity is a power of two and the table grows
+ * at 80% load. Deletion uses backward shifting, so no tombstones build up.
+ */
+class SkuIndex {
+private:
+    /**
+     * @struct Entry
+     * @brief One table bucket
+     */
+    struct Entry {
+        std::string_view key;               ///< SKU (view into the product)
+        std::uint32_t hash = 0;             ///< Cached hash of key
+        std::uint32_t value = EMPTY;        ///< Slot index, EMPTY if unused
+    };
+
+    static const std::uint32_t EMPTY = 0xFFFFFFFFu;  ///< Marks an unused bucket
+
+    std::vector<Entry> table;   ///< Bucket array (size is a power of two)
+    size_t count;               ///< Number of occupied buckets
+
+    /**
+     * @brief Hash a SKU (FNV-1a with a final avalanche mix)
+     * @param key SKU to hash
+     * @return 32-bit hash
+     */
+    static std::uint32_t hashKey(std::string_view key);
+
+    /**
+     * @brief Distance of a bucket's entry from its home bucket
+     * @param hash Entry hash
+     * @param position Bucket the entry occupies
+     * @return Probe distance
+     */
+    size_t probeDistance(std::uint32_t hash, size_t position) const;
+
+    /**
+     * @brief Find the bucket holding key
+     * @param key SKU to locate
+     * @param hash Precomputed hash of key
+     * @return Bucket position, or table.size() if absent
+     */
+    size_t findPosition(std::string_view key, std::uint32_t hash) const;
+
+    /**
+     * @brief Insert an entry known to be absent (no growth check)
+     * @param entry Entry to place
+     */
+    void place(Entry entry);
+
+    /**
+     * @brief Re-hash all entries into a table of a new capacity
+     * @param capacity New bucket count (power of two)
+     */
+    void rehash(size_t capacity);
+
+public:
+    /**
+     * @brief Constructor - creates an empty index
+     */
+    SkuIndex();
+
+    /**
+     * @brief Insert a SKU if it is not present yet
+     * @param key SKU (must outlive its entry)
+     * @param value Slot index to store
+     * @return true if inserted, false if the SKU already exists
+     */
+    bool insert(std::string_view key, std::uint32_t value);
+
+    /**
+     * @brief Look up a SKU
+     * @param key SKU to find
+     * @param value Receives the slot index if found
+     * @return true if found
+     */
+    bool find(std::string_view key, std::uint32_t& value) const;
+
+    /**
+     * @brief Check whether a SKU is present
+     * @param key SKU to check
+     * @return true if present
+     */
+    bool contains(std::string_view key) const;
+
+    /**
+     * @brief Remove a SKU
+     * @param key SKU to remove
+     * @return true if it was present
+     */
+    bool erase(std::string_view key);
+
+    /**
+     * @brief Remove all entries (keeps the bucket array)
+     */
+    void clear();
+
+    /**
+     * @brief Get the number of SKUs stored
+     * @return Entry count
+     */
+    size_t size() const;
+};
+
+#endif // SKUINDEX_H
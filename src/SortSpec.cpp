@@ -0,0 +1,54 @@
+/**
+ * @file SortSpec.cpp
+ * @brief Implementation of sort keys and multi-key sort specifications
+ * @author Ethan Trent
+ * @date 2025
+ */
+
+#include "SortSpec.h"
+
+const char* sortKeyName(SortKey key) {
+    switch (key) {
+        case SortKey::Sku:
+            return "SKU";
+        case SortKey::Name:
+            return "Name";
+        case SortKey::Price:
+            return "Price";
+        case SortKey::Quantity:
+            return "Quantity";
+        case SortKey::Value:
+            return "Total Value";
+        case SortKey::Category:
+            return "Category";
+    }
+    return "unknown";
+}
+
+SortSpec& SortSpec::then(SortKey key, SortOrder order) {
+    terms.push_back(Term{key, order});
+    return *this;
+}
+
+const std::vector<SortSpec::Term>& SortSpec::getTerms() const {
+    return terms;
+}
+
+bool SortSpec::isEmpty() const {
+    return terms.empty();
+}
+
+std::string SortSpec::toString() const {
+    if (terms.empty()) {
+        return "display order";
+    }
+    std::string text;
+    for (const Term& term : terms) {
+        if (!text.empty()) {
+            text += ", ";
+        }
+        text += sortKeyName(term.key);
+        text += (term.order == SortOrder::Ascending) ? " (asc)" : " (desc)";
+    }
+    return text;
+}
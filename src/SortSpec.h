@@ -0,0 +1,105 @@
+/**
+ * @file SortSpec.h
+ * @brief Sort keys and multi-key sort specifications for SmallBiz Inventory System
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * This file defines SortKey, the product attributes the inventory can
+ * sort by, and SortSpec, an ordered list of keys with a direction each,
+ * such as "category ascending, then value descending, then SKU".
+ */
+
+#ifndef SORTSPEC_H
+#define SORTSPEC_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @enum SortKey
+ * @brief Attribute a sorted view of the inventory is ordered by
+ */
+enum class SortKey {
+    Sku,       ///< SKU, alphabetical
+    Name,      ///< Name, alphabetical
+    Price,     ///< Unit price, ascending
+    Quantity,  ///< Quantity, ascending
+    Value,     ///< Stock value (price x quantity), descending
+    Category   ///< Category, alphabetical
+};
+
+/// Number of SortKey values
+const std::size_t SORT_KEY_COUNT = 6;
+
+/**
+ * @brief Get a display name for a sort key
+ * @param key Sort key
+ * @return Name such as "Total Value"
+ */
+const char* sortKeyName(SortKey key);
+
+/**
+ * @enum SortOrder
+ * @brief Direction of one key in a SortSpec
+ */
+enum class SortOrder {
+    Ascending,   ///< Smallest value (or A) first
+    Descending   ///< Largest value (or Z) first
+};
+
+/**
+ * @class SortSpec
+ * @brief Ordered list of sort keys, each with its own direction
+ *
+ * Later keys only order products that tie on every earlier key, and
+ * products that tie on all keys keep their display order, so sorting
+ * by a spec is stable. Directions are literal: Value ascending puts the
+ * lowest stock value first, unlike the single-key Value view.
+ *
+ * Example: SortSpec().then(SortKey::Category)
+ *                    .then(SortKey::Value, SortOrder::Descending)
+ *                    .then(SortKey::Sku)
+ */
+class SortSpec {
+public:
+    /**
+     * @struct Term
+     * @brief One key of the specification
+     */
+    struct Term {
+        SortKey key;       ///< Attribute compared
+        SortOrder order;   ///< Direction
+    };
+
+    /**
+     * @brief Append a key to the specification
+     * @param key Attribute to compare once earlier keys tie
+     * @param order Direction for this key
+     * @return This specification, for chaining
+     */
+    SortSpec& then(SortKey key, SortOrder order = SortOrder::Ascending);
+
+    /**
+     * @brief Get the keys in priority order
+     * @return Terms, most significant first
+     */
+    const std::vector<Term>& getTerms() const;
+
+    /**
+     * @brief Check whether the specification has no keys
+     * @return true if empty (sorting keeps the display order)
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Describe the specification, e.g. for listing headers
+     * @return Text such as "Category (asc), Total Value (desc)"
+     */
+    std::string toString() const;
+
+private:
+    std::vector<Term> terms;   ///< Keys, most significant first
+};
+
+#endif // SORTSPEC_H
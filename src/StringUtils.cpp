@@ -0,0 +1,54 @@
+/**
+ * @file StringUtils.cpp
+ * @brief Implementation of the allocation-free string helpers
+ * @author Ethan Trent
+ * @date 2025
+ */
+
+#include "StringUtils.h"
+#include <cctype>
+
+char toLowerAscii(char c) {
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+}
+
+std::string toLowerCopy(std::string_view text) {
+    std::string lower(text);
+    for (char& c : lower) {
+        c = toLowerAscii(c);
+    }
+    return lower;
+}
+
+bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (toLowerAscii(a[i]) != toLowerAscii(b[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Naive scan comparing characters in place - names and categories are
+ * short, so this beats building lower-case copies of both strings
+ */
+bool containsIgnoreCase(std::string_view haystack, std::string_view needle) {
+    if (needle.size() > haystack.size()) {
+        return false;
+    }
+    for (size_t start = 0; start + needle.size() <= haystack.size(); ++start) {
+        size_t i = 0;
+        while (i < needle.size() &&
+               toLowerAscii(haystack[start + i]) == toLowerAscii(needle[i])) {
+            ++i;
+        }
+        if (i == needle.size()) {
+            return true;
+        }
+    }
+    return false;
+}
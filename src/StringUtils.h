@@ -0,0 +1,48 @@
+/**
+ * @file StringUtils.h
+ * @brief Allocation-free string helpers for SmallBiz Inventory System
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * Small case-insensitive comparison helpers shared by the search and
+ * index code. They work on std::string_view so hot paths never have to
+ * build lower-cased copies of product fields.
+ */
+
+#ifndef STRINGUTILS_H
+#define STRINGUTILS_H
+
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Lower-case a single ASCII character
+ * @param c Character to convert
+ * @return Lower-case character
+ */
+char toLowerAscii(char c);
+
+/**
+ * @brief Make a lower-cased copy of a string
+ * @param text Text to convert
+ * @return Lower-case copy
+ */
+std::string toLowerCopy(std::string_view text);
+
+/**
+ * @brief Case-insensitive equality
+ * @param a First string
+ * @param b Second string
+ * @return true if equal ignoring ASCII case
+ */
+bool equalsIgnoreCase(std::string_view a, std::string_view b);
+
+/**
+ * @brief Case-insensitive substring test
+ * @param haystack Text to search in
+ * @param needle Text to search for (empty matches everything)
+ * @return true if needle occurs in haystack ignoring ASCII case
+ */
+bool containsIgnoreCase(std::string_view haystack, std::string_view needle);
+
+#endif // STRINGUTILS_H
@@ -0,0 +1,156 @@
+/**
+ * @file TrigramIndex.cpp
+ * @brief Implementation of the trigram inverted index
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * Trigrams are packed into 24 bits of a uint32_t after ASCII lower-casing.
+ * Queries pick the shortest posting list among the query's trigrams; if
+ * any query trigram has no list at all, nothing can match.
+ */
+
+#include "TrigramIndex.h"
+#include "StringUtils.h"
+#include <algorithm>
+#include <cstdint>
+
+// ==================== CONSTRUCTOR ====================
+
+TrigramIndex::TrigramIndex() : nextStamp(1) {
+}
+
+// ==================== PRIVATE HELPERS ====================
+
+void TrigramIndex::collectTrigrams(std::string_view text, std::vector<std::uint32_t>& trigrams) {
+    trigrams.clear();
+    for (size_t i = 0; i + 3 <= text.size(); ++i) {
+        std::uint32_t key = (static_cast<std::uint32_t>(static_cast<unsigned char>(toLowerAscii(text[i]))) << 16) |
+                            (static_cast<std::uint32_t>(static_cast<unsigned char>(toLowerAscii(text[i + 1]))) << 8) |
+                            static_cast<std::uint32_t>(static_cast<unsigned char>(toLowerAscii(text[i + 2])));
+        trigrams.push_back(key);
+    }
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+}
+
+bool TrigramIndex::isLive(const Posting& posting) const {
+    return posting.id < liveStamps.size() && liveStamps[posting.id] == posting.stamp;
+}
+
+void TrigramIndex::compact(PostingList& list) {
+    auto end = std::remove_if(list.postings.begin(), list.postings.end(),
+        [this](const Posting& posting) { return !isLive(posting); });
+    list.postings.erase(end, list.postings.end());
+    list.dead = 0;
+}
+
+// ==================== PUBLIC INTERFACE ====================
+
+void TrigramIndex::insert(std::uint32_t id, std::string_view text) {
+    if (nextStamp == 0) {
+        // Stamp counter wrapped: purge dead postings and renumber the live
+        // ones so no old stamp can be mistaken for a current one
+        for (auto& entry : lists) {
+            compact(entry.second);
+        }
+        std::uint32_t stamp = 1;
+        std::vector<std::uint32_t> renumbered(liveStamps.size(), 0);
+        for (size_t i = 0; i < liveStamps.size(); ++i) {
+            if (liveStamps[i] != 0) {
+                renumbered[i] = stamp++;
+            }
+        }
+        for (auto& entry : lists) {
+            for (Posting& posting : entry.second.postings) {
+                posting.stamp = renumbered[posting.id];
+            }
+        }
+        liveStamps.swap(renumbered);
+        nextStamp = stamp;
+    }
+
+    if (id >= liveStamps.size()) {
+        liveStamps.resize(id + 1, 0);
+    }
+    std::uint32_t stamp = nextStamp++;
+    liveStamps[id] = stamp;
+
+    std::vector<std::uint32_t> trigrams;
+    collectTrigrams(text, trigrams);
+    for (std::uint32_t trigram : trigrams) {
+        lists[trigram].postings.push_back(Posting{id, stamp});
+    }
+}
+
+void TrigramIndex::remove(std::uint32_t id, std::string_view text) {
+    if (id >= liveStamps.size() || liveStamps[id] == 0) {
+        return;  // Not indexed
+    }
+    liveStamps[id] = 0;
+
+    std::vector<std::uint32_t> trigrams;
+    collectTrigrams(text, trigrams);
+    for (std::uint32_t trigram : trigrams) {
+        auto it = lists.find(trigram);
+        if (it == lists.end()) {
+            continue;
+        }
+        PostingList& list = it->second;
+        list.dead++;
+        if (list.dead * 2 > list.postings.size()) {
+            compact(list);
+            if (list.postings.empty()) {
+                lists.erase(it);
+            }
+        }
+    }
+}
+
+bool TrigramIndex::candidates(std::string_view query, std::vector<std::uint32_t>& ids) const {
+    ids.clear();
+    if (query.size() < 3) {
+        return false;
+    }
+
+    std::vector<std::uint32_t> trigrams;
+    collectTrigrams(query, trigrams);
+
+    // The rarest trigram gives the smallest superset of the matches
+    const PostingList* rarest = nullptr;
+    for (std::uint32_t trigram : trigrams) {
+        auto it = lists.find(trigram);
+        if (it == lists.end()) {
+            return true;  // A trigram nobody has - no matches
+        }
+        if (rarest == nullptr || it->second.postings.size() < rarest->postings.size()) {
+            rarest = &it->second;
+        }
+    }
+
+    for (const Posting& posting : rarest->postings) {
+        if (isLive(posting)) {
+            ids.push_back(posting.id);
+        }
+    }
+    return true;
+}
+
+bool TrigramIndex::estimate(std::string_view query, size_t& count) const {
+    if (query.size() < 3) {
+        return false;
+    }
+    std::vector<std::uint32_t> trigrams;
+    collectTrigrams(query, trigrams);
+    count = SIZE_MAX;
+    for (std::uint32_t trigram : trigrams) {
+        auto it = lists.find(trigram);
+        count = std::min(count, it == lists.end() ? size_t(0) : it->second.postings.size());
+    }
+    return true;
+}
+
+void TrigramIndex::clear() {
+    lists.clear();
+    liveStamps.clear();
+    nextStamp = 1;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file TrigramIndex.h
+ * @brief Trigram inverted index for SmallBiz Inventory System
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * This file defines TrigramIndex, an inverted index from every three-letter
+ * sequence of a (lower-cased) text to the ids containing it. A substring
+ * query only has to verify the ids listed under its rarest trigram instead
+ * of scanning every product name.
+ */
+
+#ifndef TRIGRAMINDEX_H
+#define TRIGRAMINDEX_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class TrigramIndex
+ * @brief Case-insensitive trigram posting lists keyed by id (slot index)
+ *
+ * Removal is lazy: every insert gets a fresh stamp, and posting entries
+ * whose stamp no longer matches their id's current stamp are dead. A
+ * posting list is compacted once its dead entries outnumber the live
+ * ones, so both insert and remove stay proportional to the text length.
+ * Candidates are a superset of the true matches and must be verified.
+ */
+class TrigramIndex {
+private:
+    /**
+     * @struct Posting
+     * @brief One id listed under a trigram
+     */
+    struct Posting {
+        std::uint32_t id;     ///< Indexed id (slot index)
+        std::uint32_t stamp;  ///< Stamp of the insert that added it
+    };
+
+    /**
+     * @struct PostingList
+     * @brief All postings of one trigram plus its dead-entry count
+     */
+    struct PostingList {
+        std::vector<Posting> postings;  ///< Live and dead postings
+        size_t dead = 0;                ///< Postings known to be dead
+    };
+
+    std::unordered_map<std::uint32_t, PostingList> lists; ///< Trigram -> postings
+    std::vector<std::uint32_t> liveStamps;  ///< Current stamp per id (0 = not indexed)
+    std::uint32_t nextStamp;                ///< Stamp for the next insert
+
+    /**
+     * @brief Collect the distinct trigrams of a text (lower-cased)
+     * @param text Text to split
+     * @param trigrams Receives the packed trigram keys
+     */
+    static void collectTrigrams(std::string_view text, std::vector<std::uint32_t>& trigrams);
+
+    /**
+     * @brief Check whether a posting is still live
+     * @param posting Posting to check
+     * @return true if its stamp is the id's current stamp
+     */
+    bool isLive(const Posting& posting) const;
+
+    /**
+     * @brief Drop dead postings from one list
+     * @param list List to compact
+     */
+    void compact(PostingList& list);
+
+public:
+    /**
+     * @brief Constructor - creates an empty index
+     */
+    TrigramIndex();
+
+    /**
+     * @brief Index a text under an id
+     * Any earlier text indexed under the same id becomes dead.
+     * @param id Id to index (slot index)
+     * @param text Text to split into trigrams
+     */
+    void insert(std::uint32_t id, std::string_view text);
+
+    /**
+     * @brief Remove an id's text from the index
+     * @param id Id to remove
+     * @param text Text that was indexed for this id
+     */
+    void remove(std::uint32_t id, std::string_view text);
+
+    /**
+     * @brief Collect candidate ids for a case-insensitive substring query
+     * @param query Substring to look for
+     * @param ids Receives ids listed under the query's rarest trigram
+     * @return false if the query is shorter than three characters and the
+     *         index cannot narrow it (caller must scan)
+     */
+    bool candidates(std::string_view query, std::vector<std::uint32_t>& ids) const;
+
+    /**
+     * @brief Estimate how many candidates a query would produce
+     * Reads only posting list sizes; dead postings are included.
+     * @param query Substring to look for
+     * @param count Receives the rarest trigram's posting count
+     * @return false if the query is too short to use the index
+     */
+    bool estimate(std::string_view query, size_t& count) const;
+
+    /**
+     * @brief Remove everything from the index
+     */
+    void clear();
+};
+
+#endif // TRIGRAMINDEX_H
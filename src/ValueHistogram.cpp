@@ -0,0 +1,72 @@
+/**
+ * @file ValueHistogram.cpp
+ * @brief Implementation of the power-of-two value histogram
+ * @author Ethan Trent
+ * @date 2025
+ */
+
+#include "ValueHistogram.h"
+#include <algorithm>
+
+// ==================== PRIVATE HELPERS ====================
+
+size_t ValueHistogram::bucketOf(std::int64_t value) {
+    if (value <= 0) {
+        return 0;
+    }
+    size_t bucket = 1;
+    std::uint64_t rest = static_cast<std::uint64_t>(value);
+    while (rest > 1) {
+        rest >>= 1;
+        ++bucket;
+    }
+    return std::min(bucket, BUCKETS - 1);
+}
+
+// ==================== PUBLIC INTERFACE ====================
+
+void ValueHistogram::add(std::int64_t value) {
+    counts[bucketOf(value)]++;
+    total++;
+}
+
+void ValueHistogram::remove(std::int64_t value) {
+    size_t bucket = bucketOf(value);
+    if (counts[bucket] > 0) {
+        counts[bucket]--;
+        total--;
+    }
+}
+
+/**
+ * Sums whole buckets inside the range and the overlapping fraction of
+ * the buckets at either end
+ */
+double ValueHistogram::estimateRange(std::int64_t low, std::int64_t high) const {
+    low = std::max<std::int64_t>(low, 0);
+    if (high < low) {
+        return 0.0;
+    }
+    double estimate = 0.0;
+    for (size_t bucket = bucketOf(low); bucket <= bucketOf(high); ++bucket) {
+        if (counts[bucket] == 0) {
+            continue;
+        }
+        // Bucket bounds as doubles so the top bucket cannot overflow
+        double first = (bucket == 0) ? 0.0 : static_cast<double>(std::uint64_t(1) << (bucket - 1));
+        double last = (bucket == 0) ? 0.0 : 2.0 * first - 1.0;
+        double from = std::max(first, static_cast<double>(low));
+        double to = std::min(last, static_cast<double>(high));
+        estimate += counts[bucket] * (to - from + 1.0) / (last - first + 1.0);
+    }
+    return estimate;
+}
+
+std::size_t ValueHistogram::size() const {
+    return total;
+}
+
+void ValueHistogram::clear() {
+    counts.fill(0);
+    total = 0;
+}
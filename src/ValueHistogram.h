@@ -0,0 +1,75 @@
+/**
+ * @file ValueHistogram.h
+ * @brief Value distribution statistics for SmallBiz Inventory System
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * This file defines ValueHistogram, a small fixed-size histogram kept up
+ * to date as products change. The query planner uses it to estimate how
+ * many products fall inside a price or quantity range.
+ */
+
+#ifndef VALUEHISTOGRAM_H
+#define VALUEHISTOGRAM_H
+
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @class ValueHistogram
+ * @brief Counts of non-negative values in power-of-two buckets
+ *
+ * Bucket 0 holds the value 0 and bucket b holds [2^(b-1), 2^b - 1], so
+ * 64 buckets cover every int64 and add/remove are O(1). Buckets are
+ * narrow where prices and quantities cluster (small values) and wide
+ * where they are sparse. Range estimates assume values are spread evenly
+ * inside a bucket. Negative values are counted as 0.
+ */
+class ValueHistogram {
+private:
+    static const size_t BUCKETS = 64;               ///< Bucket count
+    std::array<std::size_t, BUCKETS> counts{};      ///< Values per bucket
+    std::size_t total = 0;                          ///< Values counted
+
+    /**
+     * @brief Bucket holding a value
+     * @param value Value to place
+     * @return Bucket number
+     */
+    static size_t bucketOf(std::int64_t value);
+
+public:
+    /**
+     * @brief Count a value
+     * @param value Value to add
+     */
+    void add(std::int64_t value);
+
+    /**
+     * @brief Stop counting a value that was added earlier
+     * @param value Value to remove
+     */
+    void remove(std::int64_t value);
+
+    /**
+     * @brief Estimate how many values lie in [low, high]
+     * @param low Lowest value included
+     * @param high Highest value included
+     * @return Estimated count (0 if high < low)
+     */
+    double estimateRange(std::int64_t low, std::int64_t high) const;
+
+    /**
+     * @brief Get the number of values counted
+     * @return Total count
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Forget all values
+     */
+    void clear();
+};
+
+#endif // VALUEHISTOGRAM_H
@@ -12,14 +12,18 @@
 #include <iostream>
 #include <string>
 #include <limits>
+#include <climits>
 #include <iomanip>
+#include <functional>
 #include "Inventory.h"
 #include "PhysicalProduct.h"
 #include "DigitalProduct.h"
+#include "FilterKernels.h"
 
 // ==================== CONSTANTS ====================
 const std::string DATA_FILE = "inventory.csv";
 const int LOW_STOCK_THRESHOLD = 10;
+const size_t PAGE_SIZE = 20;
 
 // ==================== FUNCTION PROTOTYPES ====================
 void displayMenu();
@@ -32,6 +36,8 @@ void removeProduct(Inventory& inventory);
 void searchProducts(Inventory& inventory);
 void sortProducts(Inventory& inventory);
 void displayReports(Inventory& inventory);
+void showPages(Inventory& inventory,
+               const std::function<bool(const std::string&, Inventory::Page&)>& fetchPage);
 
 // Input helpers with validation
 int getIntInput(const std::string& prompt, int min = INT_MIN, int max = INT_MAX);
@@ -155,6 +161,11 @@ void displaySearchMenu() {
     std::cout << "2. Search by Name\n";
     std::cout << "3. Search by Category\n";
     std::cout << "4. Search by Type (Physical/Digital)\n";
+    std::cout << "5. Search by SKU Prefix\n";
+    std::cout << "6. Search by Price Range\n";
+    std::cout << "7. Filter by Attributes\n";
+    std::cout << "8. Advanced Search (combine criteria)\n";
+    std::cout << "9. Search by Minimum Stock Value\n";
     std::cout << "0. Back to Main Menu\n";
 }
 
@@ -168,6 +179,8 @@ void displaySortMenu() {
     std::cout << "3. Sort by Price\n";
     std::cout << "4. Sort by Quantity\n";
     std::cout << "5. Sort by Total Value\n";
+    std::cout << "6. Sort by Category\n";
+    std::cout << "7. Custom Sort (several keys)\n";
     std::cout << "0. Back to Main Menu\n";
 }
 
@@ -207,7 +220,7 @@ void addProduct(Inventory& inventory) {
         std::string supplier = getStringInput("Enter supplier name");
         
         // Dynamically allocate using new
-        newProduct = new PhysicalProduct(sku, name, price, quantity, category, 
+        newProduct = new PhysicalProduct(sku, name, Money::fromDouble(price), quantity, category, 
                                          weight, supplier);
     } else {
         // Digital product - get additional attributes
@@ -216,7 +229,7 @@ void addProduct(Inventory& inventory) {
         std::string licenseType = getStringInput("Enter license type (Single/Multi-user/Enterprise)");
         
         // Dynamically allocate using new
-        newProduct = new DigitalProduct(sku, name, price, quantity, category,
+        newProduct = new DigitalProduct(sku, name, Money::fromDouble(price), quantity, category,
                                         downloadLink, fileSize, licenseType);
     }
     
@@ -235,7 +248,15 @@ void addProduct(Inventory& inventory) {
  */
 void viewProducts(Inventory& inventory) {
     std::cout << "\n========== INVENTORY LIST ==========\n";
-    inventory.displayAll();
+    if (inventory.isEmpty()) {
+        std::cout << "\n[!] Inventory is empty.\n";
+    } else {
+        std::cout << "Total Products: " << inventory.getProductCount()
+                  << " | Total Value: $" << inventory.getTotalValue() << "\n";
+        showPages(inventory, [&inventory](const std::string& token, Inventory::Page& page) {
+            return inventory.listPage(PAGE_SIZE, token, page);
+        });
+    }
     pauseScreen();
 }
 
@@ -253,7 +274,7 @@ void editProduct(Inventory& inventory) {
     
     std::string sku = getStringInput("Enter SKU of product to edit");
     
-    Product* product = inventory.getProduct(sku);
+    const Product* product = inventory.getProduct(sku);
     if (product == nullptr) {
         std::cout << "\n[ERROR] Product with SKU '" << sku << "' not found!\n";
         pauseScreen();
@@ -282,7 +303,8 @@ void editProduct(Inventory& inventory) {
     clearInputBuffer();
     
     // Update product
-    if (inventory.updateProduct(sku, newName, newPrice, newQuantity)) {
+    Money priceUpdate = (newPrice < 0) ? Money::fromCents(-1) : Money::fromDouble(newPrice);
+    if (inventory.updateProduct(sku, newName, priceUpdate, newQuantity)) {
         std::cout << "\n[OK] Product updated successfully!\n";
         
         // Display updated info
@@ -310,7 +332,7 @@ void removeProduct(Inventory& inventory) {
     
     std::string sku = getStringInput("Enter SKU of product to remove");
     
-    Product* product = inventory.getProduct(sku);
+    const Product* product = inventory.getProduct(sku);
     if (product == nullptr) {
         std::cout << "\n[ERROR] Product with SKU '" << sku << "' not found!\n";
         pauseScreen();
@@ -348,27 +370,33 @@ void searchProducts(Inventory& inventory) {
     }
     
     displaySearchMenu();
-    int choice = getIntInput("Select search option", 0, 4);
+    int choice = getIntInput("Select search option", 0, 9);
     
-    std::vector<Product*> results;
+    std::vector<ProductHandle> results;
+    // Set instead of results by searches that are shown a page at a time
+    std::function<bool(const std::string&, Inventory::Page&)> fetchPage;
     
     switch (choice) {
         case 1: {
             std::string sku = getStringInput("Enter SKU to search");
-            Product* product = inventory.getProduct(sku);
-            if (product != nullptr) {
-                results.push_back(product);
+            ProductHandle handle = inventory.findHandle(sku);
+            if (!handle.isNull()) {
+                results.push_back(handle);
             }
             break;
         }
         case 2: {
             std::string name = getStringInput("Enter name to search (partial match)");
-            results = inventory.searchByName(name);
+            fetchPage = [&inventory, name](const std::string& token, Inventory::Page& page) {
+                return inventory.searchByNamePage(name, PAGE_SIZE, token, page);
+            };
             break;
         }
         case 3: {
             std::string category = getStringInput("Enter category to search");
-            results = inventory.searchByCategory(category);
+            fetchPage = [&inventory, category](const std::string& token, Inventory::Page& page) {
+                return inventory.searchByCategoryPage(category, PAGE_SIZE, token, page);
+            };
             break;
         }
         case 4: {
@@ -376,6 +404,74 @@ void searchProducts(Inventory& inventory) {
             results = inventory.searchByType(type);
             break;
         }
+        case 5: {
+            std::string prefix = getStringInput("Enter SKU prefix (e.g. TOOL-)");
+            results = inventory.findBySkuPrefix(prefix);
+            break;
+        }
+        case 6: {
+            double low = getDoubleInput("Enter minimum price ($)", 0);
+            double high = getDoubleInput("Enter maximum price ($)", low);
+            results = inventory.findByPriceRange(Money::fromDouble(low), Money::fromDouble(high));
+            break;
+        }
+        case 7: {
+            std::cout << "Leave a field blank to match any value.\n";
+            Inventory::AttributeFilter filter;
+            filter.type = getStringInput("Type (Physical/Digital)", true);
+            filter.category = getStringInput("Category", true);
+            filter.supplier = getStringInput("Supplier", true);
+            filter.licenseType = getStringInput("License type", true);
+            results = inventory.filterByAttributes(filter);
+            break;
+        }
+        case 8: {
+            // Every non-blank criterion is ANDed into one query
+            std::cout << "Leave a field blank to skip that criterion.\n";
+            std::vector<Query> criteria;
+            std::string name = getStringInput("Name contains", true);
+            if (!name.empty()) {
+                criteria.push_back(Query::nameContains(name));
+            }
+            std::string category = getStringInput("Category contains", true);
+            if (!category.empty()) {
+                criteria.push_back(Query::categoryContains(category));
+            }
+            std::string typeText = getStringInput("Type (Physical/Digital)", true);
+            ProductType type;
+            if (!typeText.empty()) {
+                if (!Product::parseType(typeText, type)) {
+                    std::cout << "\n[!] Unknown type.\n";
+                    pauseScreen();
+                    return;
+                }
+                criteria.push_back(Query::type(type));
+            }
+            std::string maxPrice = getStringInput("Price under ($)", true);
+            if (!maxPrice.empty()) {
+                Money limit;
+                if (!Money::parse(maxPrice, limit)) {
+                    std::cout << "\n[!] Invalid price.\n";
+                    pauseScreen();
+                    return;
+                }
+                criteria.push_back(Query::priceBelow(limit));
+            }
+            Query query = Query::allOf(criteria);
+            fetchPage = [&inventory, query](const std::string& token, Inventory::Page& page) {
+                return inventory.queryPage(query, PAGE_SIZE, token, page);
+            };
+            char showPlan = getCharInput("Show query plan? (y/n)");
+            if (showPlan == 'y' || showPlan == 'Y') {
+                std::cout << "\n" << inventory.explain(query);
+            }
+            break;
+        }
+        case 9: {
+            double minimum = getDoubleInput("Enter minimum stock value (price x quantity, $)", 0);
+            results = inventory.findByMinValue(Money::fromDouble(minimum));
+            break;
+        }
         case 0:
             return;
         default:
@@ -386,12 +482,16 @@ void searchProducts(Inventory& inventory) {
     
     // Display search results
     std::cout << "\n========== SEARCH RESULTS ==========\n";
-    std::cout << "Found " << results.size() << " product(s).\n\n";
-    
-    if (!results.empty()) {
-        Product::displayHeader();
-        for (Product* product : results) {
-            product->display();
+    if (fetchPage) {
+        showPages(inventory, fetchPage);
+    } else {
+        std::cout << "Found " << results.size() << " product(s).\n\n";
+        
+        if (!results.empty()) {
+            Product::displayHeader();
+            for (ProductHandle handle : results) {
+                inventory.resolve(handle)->display();
+            }
         }
     }
     
@@ -409,37 +509,47 @@ void sortProducts(Inventory& inventory) {
     }
     
     displaySortMenu();
-    int choice = getIntInput("Select sort option", 0, 5);
+    int choice = getIntInput("Select sort option", 0, 7);
+    if (choice == 0) {
+        return;
+    }
     
-    switch (choice) {
-        case 1:
-            inventory.sortBySku();
-            std::cout << "\n[OK] Inventory sorted by SKU.\n";
-            break;
-        case 2:
-            inventory.sortByName();
-            std::cout << "\n[OK] Inventory sorted by Name.\n";
-            break;
-        case 3:
-            inventory.sortByPrice();
-            std::cout << "\n[OK] Inventory sorted by Price.\n";
-            break;
-        case 4:
-            inventory.sortByQuantity();
-            std::cout << "\n[OK] Inventory sorted by Quantity.\n";
-            break;
-        case 5:
-            inventory.sortByValue();
-            std::cout << "\n[OK] Inventory sorted by Total Value.\n";
-            break;
-        case 0:
+    // Sorted listings come from cached views and leave the stored order alone
+    const SortKey keys[] = {SortKey::Sku, SortKey::Name, SortKey::Price,
+                            SortKey::Quantity, SortKey::Value, SortKey::Category};
+    SortSpec spec;
+    if (choice == 7) {
+        // Build the spec one key at a time, most significant first
+        std::cout << "Keys: 1=SKU 2=Name 3=Price 4=Quantity 5=Total Value 6=Category\n";
+        for (size_t term = 1; term <= SORT_KEY_COUNT; ++term) {
+            int key = getIntInput("Key " + std::to_string(term) + " (0 = done)", 0, 6);
+            if (key == 0) {
+                break;
+            }
+            char descending = getCharInput("Descending? (y/n)");
+            spec.then(keys[key - 1], (descending == 'y' || descending == 'Y')
+                                         ? SortOrder::Descending : SortOrder::Ascending);
+        }
+        if (spec.isEmpty()) {
+            std::cout << "\n[!] No sort keys chosen.\n";
+            pauseScreen();
             return;
-        default:
-            std::cout << "\n[!] Invalid option.\n";
+        }
+        inventory.displaySorted(spec);
+    } else {
+        inventory.displaySorted(keys[choice - 1]);
     }
     
-    // Display sorted inventory
-    inventory.displayAll();
+    char keep = getCharInput("\nKeep this order for the inventory? (y/n)");
+    if (keep == 'y' || keep == 'Y') {
+        if (choice == 7) {
+            inventory.sortBy(spec);
+            std::cout << "\n[OK] Inventory sorted by " << spec.toString() << ".\n";
+        } else {
+            inventory.sortBy(keys[choice - 1]);
+            std::cout << "\n[OK] Inventory sorted by " << sortKeyName(keys[choice - 1]) << ".\n";
+        }
+    }
     pauseScreen();
 }
 
@@ -451,9 +561,12 @@ void displayReports(Inventory& inventory) {
     std::cout << "1. Inventory Summary\n";
     std::cout << "2. Low Stock Alert\n";
     std::cout << "3. High Value Items\n";
+    std::cout << "4. Storage Layout Report\n";
+    std::cout << "5. Supplier Reorder Lists\n";
+    std::cout << "6. Search Cache Statistics\n";
     std::cout << "0. Back to Main Menu\n";
     
-    int choice = getIntInput("Select report", 0, 3);
+    int choice = getIntInput("Select report", 0, 6);
     
     switch (choice) {
         case 1:
@@ -465,9 +578,34 @@ void displayReports(Inventory& inventory) {
             break;
         }
         case 3: {
-            std::cout << "\n===== TOP VALUE ITEMS =====\n";
-            inventory.sortByValue();
-            inventory.displayAll();
+            int count = getIntInput("How many items to show", 1, 1000);
+            inventory.displayTopByValue(static_cast<size_t>(count));
+            break;
+        }
+        case 4: {
+            inventory.displayLayoutReport();
+            // The only place the process-wide kernel choice is changed
+            bool simd = std::string(filterKernelName()) != "scalar";
+            char toggle = getCharInput(simd ? "\nUse the scalar filter kernels from now on? (y/n)"
+                                            : "\nUse the AVX2 filter kernels if supported? (y/n)");
+            if (toggle == 'y' || toggle == 'Y') {
+                setSimdFilters(!simd);
+                std::cout << "\n[OK] Filter kernels: " << filterKernelName() << ".\n";
+            }
+            break;
+        }
+        case 5: {
+            int threshold = getIntInput("Enter low stock threshold", 1, 1000);
+            inventory.displayReorderLists(threshold);
+            break;
+        }
+        case 6: {
+            inventory.displayQueryCacheStats();
+            char reset = getCharInput("\nReset the counters? (y/n)");
+            if (reset == 'y' || reset == 'Y') {
+                inventory.resetQueryCacheStats();
+                std::cout << "\n[OK] Search cache counters reset.\n";
+            }
             break;
         }
         case 0:
@@ -477,6 +615,41 @@ void displayReports(Inventory& inventory) {
     pauseScreen();
 }
 
+/**
+ * Shows results PAGE_SIZE rows at a time, asking before each further page
+ */
+void showPages(Inventory& inventory,
+               const std::function<bool(const std::string&, Inventory::Page&)>& fetchPage) {
+    Inventory::Page page;
+    std::string token;
+    size_t shown = 0;
+    while (true) {
+        if (!fetchPage(token, page)) {
+            std::cout << "\n[!] This listing can no longer be continued; please start it again.\n";
+            return;
+        }
+        if (shown == 0 && page.items.empty()) {
+            std::cout << "Found 0 product(s).\n";
+            return;
+        }
+        std::cout << "\n";
+        Product::displayHeader();
+        for (ProductHandle handle : page.items) {
+            inventory.resolve(handle)->display();
+        }
+        std::cout << "Showing " << shown + 1 << "-" << shown + page.items.size() << "\n";
+        shown += page.items.size();
+        token = page.nextToken;
+        if (token.empty()) {
+            return;
+        }
+        char more = getCharInput("Show next page? (y/n)");
+        if (more != 'y' && more != 'Y') {
+            return;
+        }
+    }
+}
+
 // ==================== INPUT HELPER FUNCTIONS ====================
 
 /**
@@ -0,0 +1,198 @@
+/**
+ * @file AllocationTest.cpp
+ * @brief Checks that lookups, repeated searches and sorts stay off the heap
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * Replaces the global operator new with a counting version. SKU and
+ * handle lookups must not allocate at all. A repeated name or category
+ * search is answered from the query cache and may only allocate the
+ * vector it returns. Re-sorting by a view that is already built, and
+ * patching built views (the sortLess comparators) on an edit, must add
+ * no allocations.
+ */
+
+#include "TestSupport.h"
+#include "Inventory.h"
+#include "SkuIndex.h"
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::size_t allocationCount = 0;
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    allocationCount++;
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+namespace {
+
+const char* const WORDS[] = {"Widget", "Drill", "Chair", "Lamp", "Suite"};
+const char* const CATEGORIES[] = {"Tools", "Furniture", "Software"};
+
+/**
+ * Fills an inventory with products whose names and categories repeat
+ */
+void populate(Inventory& inventory, int count) {
+    for (int i = 0; i < count; ++i) {
+        inventory.addProduct(new PhysicalProduct("SKU-" + std::to_string(i),
+                                                 std::string(WORDS[i % 5]) + " " + std::to_string(i % 97),
+                                                 Money::fromCents(100 + (i * 37) % 5000), (i * 13) % 50,
+                                                 CATEGORIES[i % 3], 1.0, "Acme"));
+    }
+}
+
+void testInventoryLookups() {
+    Inventory inventory("allocation_test_unused.csv");
+    std::vector<std::string> skus;
+    for (int i = 0; i < 2000; ++i) {
+        skus.push_back("SKU-" + std::to_string(i));
+        inventory.addProduct(new PhysicalProduct(skus.back(), "Item " + std::to_string(i),
+                                                 Money::fromCents(100 + i), i % 50, "Tools", 1.0, "Acme"));
+    }
+    // Strings are built up front so only the lookups themselves are counted
+    std::vector<std::string> missing;
+    for (int i = 0; i < 300; ++i) {
+        missing.push_back("NONE-" + std::to_string(i));
+    }
+
+    const std::size_t before = allocationCount;
+    std::size_t found = 0;
+    for (const std::string& sku : skus) {
+        const Product* product = inventory.getProduct(sku);
+        ProductHandle handle = inventory.findHandle(sku);
+        if (product != nullptr && inventory.resolve(handle) == product && inventory.isValid(handle)) {
+            found++;
+        }
+    }
+    for (const std::string& sku : missing) {
+        if (inventory.getProduct(sku) == nullptr && inventory.findHandle(sku).isNull()) {
+            found++;
+        }
+    }
+    CHECK(allocationCount == before);
+    CHECK(found == skus.size() + missing.size());
+}
+
+void testRepeatedSearches() {
+    Inventory inventory("allocation_test_unused.csv");
+    populate(inventory, 2000);
+    const std::vector<std::string> terms = {"Widget", "wid", "LAMP 4", "ch", "nothing like it"};
+    const std::vector<std::string> categories = {"tools", "FURN", "o", "Garden"};
+    // The first call of each search fills the cache
+    for (const std::string& term : terms) {
+        inventory.searchByName(term);
+    }
+    for (const std::string& category : categories) {
+        inventory.searchByCategory(category);
+    }
+
+    for (int round = 0; round < 3; ++round) {
+        for (const std::string& term : terms) {
+            const std::size_t before = allocationCount;
+            std::vector<ProductHandle> results = inventory.searchByName(term);
+            CHECK(allocationCount - before == (results.empty() ? 0u : 1u));
+        }
+        for (const std::string& category : categories) {
+            const std::size_t before = allocationCount;
+            std::vector<ProductHandle> results = inventory.searchByCategory(category);
+            CHECK(allocationCount - before == (results.empty() ? 0u : 1u));
+        }
+    }
+    CHECK(inventory.getQueryCacheStats().hits == 3 * (terms.size() + categories.size()));
+}
+
+void testSortsOnBuiltViews() {
+    const SortKey keys[] = {SortKey::Sku, SortKey::Name, SortKey::Price,
+                            SortKey::Quantity, SortKey::Value, SortKey::Category};
+    Inventory withViews("allocation_test_unused.csv");
+    Inventory withoutViews("allocation_test_unused.csv");
+    populate(withViews, 3000);
+    populate(withoutViews, 3000);
+    for (SortKey key : keys) {
+        withViews.sortBy(key);
+    }
+
+    // Every view is built, so sortBy only copies one into the display order
+    std::size_t before = allocationCount;
+    for (int round = 0; round < 2; ++round) {
+        for (SortKey key : keys) {
+            withViews.sortBy(key);
+        }
+    }
+    CHECK(allocationCount == before);
+
+    // An edit moves its slot in every built view by binary search with
+    // sortLess; that must cost nothing on top of the edit itself
+    std::vector<std::string> skus;
+    for (int i = 0; i < 200; ++i) {
+        skus.push_back("SKU-" + std::to_string(i * 11));
+    }
+    auto editCost = [&skus](Inventory& inventory) {
+        const std::size_t start = allocationCount;
+        for (std::size_t i = 0; i < skus.size(); ++i) {
+            inventory.setPrice(skus[i], Money::fromCents(static_cast<std::int64_t>(i * 7919 % 6000)));
+            inventory.setQuantity(skus[i], static_cast<int>(i * 31 % 60));
+        }
+        return allocationCount - start;
+    };
+    CHECK(editCost(withViews) == editCost(withoutViews));
+
+    // The patched view still matches one sorted from scratch
+    withoutViews.sortBy(SortKey::Value);
+    CHECK(withViews.getSortedView(SortKey::Value) == withoutViews.findAll(Query::everything()));
+}
+
+void testSkuIndexFind() {
+    std::vector<std::string> keys;
+    for (int i = 0; i < 5000; ++i) {
+        keys.push_back("P" + std::to_string(i * 7));
+    }
+    SkuIndex index;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        index.insert(keys[i], static_cast<std::uint32_t>(i));
+    }
+    // Erasing leaves backward-shifted runs behind, which find must still walk
+    for (std::size_t i = 0; i < keys.size(); i += 3) {
+        index.erase(keys[i]);
+    }
+
+    const std::size_t before = allocationCount;
+    std::size_t correct = 0;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        std::uint32_t value = 0;
+        bool present = index.find(keys[i], value);
+        if (present == (i % 3 != 0) && (!present || value == i)) {
+            correct++;
+        }
+    }
+    CHECK(allocationCount == before);
+    CHECK(correct == keys.size());
+}
+
+} // namespace
+
+int main() {
+    testInventoryLookups();
+    testRepeatedSearches();
+    testSortsOnBuiltViews();
+    testSkuIndexFind();
+    return testExitCode("AllocationTest");
+}
@@ -0,0 +1,365 @@
+/**
+ * @file ModelTest.cpp
+ * @brief Randomized check of sorted views and cached searches against a model
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * Applies random adds, removes, setPrice, setQuantity, setName,
+ * setCategory, updateProduct and re-sorts to an inventory and mirrors
+ * each one in a plain map of product fields. After every step each
+ * getSortedView(SortKey) is compared with a std::stable_sort of the model,
+ * in the order sortLess defines (ties by slot index), so incremental view
+ * patching and the radix-sorted price, quantity and value views (32+
+ * products) are both covered as the inventory grows and shrinks. Random
+ * SortSpecs are checked the same way, and cached name, category and
+ * paged query results must match the model after every edit.
+ */
+
+#include "TestSupport.h"
+#include "Inventory.h"
+#include "StringUtils.h"
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+const char* const NAMES[] = {"Drill", "drill", "Lamp", "Chair", "Desk Lamp", "Widget", "Suite"};
+const char* const CATEGORIES[] = {"Tools", "Office", "Software", "Garden"};
+const SortKey KEYS[] = {SortKey::Sku, SortKey::Name, SortKey::Price,
+                        SortKey::Quantity, SortKey::Value, SortKey::Category};
+
+/**
+ * @struct Record
+ * @brief Expected fields of one product
+ */
+struct Record {
+    std::string name;
+    std::int64_t cents;
+    int quantity;
+    std::string category;
+
+    std::int64_t value() const {
+        return cents * quantity;
+    }
+};
+
+class Model {
+public:
+    Model() : inventory("model_test_unused.csv"), rng(45), nextSku(0) {}
+
+    // ==================== OPERATIONS ====================
+
+    void step(std::size_t target) {
+        const bool grow = records.size() < target;
+        switch (rng() % 11) {
+            case 0:
+            case 1:
+            case 2:
+                if (grow) {
+                    add();
+                } else {
+                    remove();
+                }
+                break;
+            case 3:
+                if (grow) {
+                    remove();
+                } else {
+                    add();
+                }
+                break;
+            case 4: {
+                std::string sku = pickSku();
+                std::int64_t cents = randomCents();
+                // A negative price is rejected and changes nothing
+                bool valid = rng() % 8 != 0;
+                CHECK(inventory.setPrice(sku, Money::fromCents(valid ? cents : -1 - cents)) ==
+                      (valid && records.count(sku) == 1));
+                if (valid && records.count(sku) == 1) {
+                    records[sku].cents = cents;
+                }
+                break;
+            }
+            case 5: {
+                std::string sku = pickSku();
+                int quantity = static_cast<int>(rng() % 12);
+                CHECK(inventory.setQuantity(sku, quantity) == (records.count(sku) == 1));
+                if (records.count(sku) == 1) {
+                    records[sku].quantity = quantity;
+                }
+                break;
+            }
+            case 6: {
+                std::string sku = pickSku();
+                std::string name = NAMES[rng() % 7];
+                CHECK(inventory.setName(sku, name) == (records.count(sku) == 1));
+                if (records.count(sku) == 1) {
+                    records[sku].name = name;
+                }
+                break;
+            }
+            case 7: {
+                std::string sku = pickSku();
+                std::string category = CATEGORIES[rng() % 4];
+                CHECK(inventory.setCategory(sku, category) == (records.count(sku) == 1));
+                if (records.count(sku) == 1) {
+                    records[sku].category = category;
+                }
+                break;
+            }
+            case 8: {
+                // Each field is either changed or kept
+                std::string sku = pickSku();
+                std::string name = (rng() % 2 == 0) ? "" : NAMES[rng() % 7];
+                std::int64_t cents = (rng() % 2 == 0) ? -1 : randomCents();
+                int quantity = (rng() % 2 == 0) ? -1 : static_cast<int>(rng() % 12);
+                CHECK(inventory.updateProduct(sku, name, Money::fromCents(cents), quantity) ==
+                      (records.count(sku) == 1));
+                if (records.count(sku) == 1) {
+                    Record& record = records[sku];
+                    record.name = name.empty() ? record.name : name;
+                    record.cents = cents < 0 ? record.cents : cents;
+                    record.quantity = quantity < 0 ? record.quantity : quantity;
+                }
+                break;
+            }
+            case 9:
+                inventory.sortBy(KEYS[rng() % SORT_KEY_COUNT]);
+                break;
+            default:
+                inventory.sortBy(randomSpec());
+                break;
+        }
+    }
+
+    // ==================== CHECKS ====================
+
+    void checkAll() {
+        std::vector<ProductHandle> display = inventory.findAll(Query::everything());
+        CHECK(display.size() == records.size());
+        for (ProductHandle handle : display) {
+            const Product* product = inventory.resolve(handle);
+            CHECK(product != nullptr && records.count(product->getSku()) == 1);
+            if (product != nullptr && records.count(product->getSku()) == 1) {
+                const Record& record = records[product->getSku()];
+                CHECK(product->getName() == record.name && product->getPrice().getCents() == record.cents &&
+                      product->getQuantity() == record.quantity && product->getCategory() == record.category);
+            }
+        }
+
+        for (SortKey key : KEYS) {
+            std::vector<ProductHandle> expected = display;
+            std::stable_sort(expected.begin(), expected.end(), [&](ProductHandle a, ProductHandle b) {
+                return viewLess(key, a, b);
+            });
+            CHECK(inventory.getSortedView(key) == expected);
+        }
+
+        SortSpec spec = randomSpec();
+        std::vector<ProductHandle> expected = display;
+        std::stable_sort(expected.begin(), expected.end(), [&](ProductHandle a, ProductHandle b) {
+            return specLess(spec, a, b);
+        });
+        CHECK(inventory.getSorted(spec) == expected);
+
+        // Searches may be answered from the cache; they must still see every edit
+        std::string term = toLowerCopy(NAMES[rng() % 7]).substr(0, 1 + rng() % 4);
+        std::string category = toLowerCopy(CATEGORIES[rng() % 4]).substr(rng() % 2, 2 + rng() % 3);
+        std::vector<ProductHandle> named = filter(display, [&](const Record& record) {
+            return toLowerCopy(record.name).find(term) != std::string::npos;
+        });
+        CHECK(inventory.searchByName(term) == named);
+        const std::size_t hits = inventory.getQueryCacheStats().hits;
+        CHECK(inventory.searchByName(term) == named);
+        CHECK(inventory.getQueryCacheStats().hits == hits + 1);
+        CHECK(inventory.searchByCategory(category) == filter(display, [&](const Record& record) {
+            return toLowerCopy(record.category).find(category) != std::string::npos;
+        }));
+
+        const char* exact = CATEGORIES[rng() % 4];
+        int low = static_cast<int>(rng() % 6);
+        Query query = Query::category(exact) && Query::quantityBetween(low, low + 1);
+        std::vector<ProductHandle> paged;
+        std::string token;
+        Inventory::Page page;
+        do {
+            if (!inventory.queryPage(query, 1 + rng() % 4, token, page)) {
+                CHECK(false && "queryPage rejected a fresh token");
+                break;
+            }
+            paged.insert(paged.end(), page.items.begin(), page.items.end());
+            token = page.nextToken;
+        } while (!token.empty());
+        CHECK(paged == filter(display, [&](const Record& record) {
+            return record.category == exact && record.quantity >= low && record.quantity <= low + 1;
+        }));
+    }
+
+    std::size_t size() const {
+        return records.size();
+    }
+
+    Inventory inventory;
+
+private:
+    // ==================== HELPERS ====================
+
+    void add() {
+        // Sometimes re-add a removed SKU, so its slot is reused with a new generation
+        std::string sku = (!removed.empty() && rng() % 3 == 0) ? removed[rng() % removed.size()]
+                                                               : "M" + std::to_string(nextSku++);
+        if (records.count(sku) == 1) {
+            return;
+        }
+        Record record{NAMES[rng() % 7], randomCents(), static_cast<int>(rng() % 12), CATEGORIES[rng() % 4]};
+        Product* product;
+        if (rng() % 2 == 0) {
+            product = new PhysicalProduct(sku, record.name, Money::fromCents(record.cents), record.quantity,
+                                          record.category, 1.0, "Acme");
+        } else {
+            product = new DigitalProduct(sku, record.name, Money::fromCents(record.cents), record.quantity,
+                                         record.category, "n/a", 1.0, "Single");
+        }
+        CHECK(inventory.addProduct(product));
+        records[sku] = record;
+    }
+
+    void remove() {
+        std::string sku = pickSku();
+        CHECK(inventory.removeProduct(sku) == (records.count(sku) == 1));
+        if (records.erase(sku) == 1) {
+            removed.push_back(sku);
+        }
+    }
+
+    /**
+     * Usually a live SKU, sometimes one that does not exist
+     */
+    std::string pickSku() {
+        if (records.empty() || rng() % 10 == 0) {
+            return "NONE";
+        }
+        auto it = records.begin();
+        std::advance(it, rng() % records.size());
+        return it->first;
+    }
+
+    /**
+     * Few distinct prices, so price and value ties are common
+     */
+    std::int64_t randomCents() {
+        return static_cast<std::int64_t>(rng() % 20) * 250;
+    }
+
+    SortSpec randomSpec() {
+        SortSpec spec;
+        for (unsigned i = 0, terms = 1 + rng() % 3; i < terms; ++i) {
+            spec.then(KEYS[rng() % SORT_KEY_COUNT], rng() % 2 == 0 ? SortOrder::Ascending : SortOrder::Descending);
+        }
+        return spec;
+    }
+
+    const Record& recordFor(ProductHandle handle) {
+        return records[inventory.resolve(handle)->getSku()];
+    }
+
+    /**
+     * -1, 0 or 1 as a's key is below, equal to or above b's
+     */
+    int compareKey(SortKey key, ProductHandle a, ProductHandle b) {
+        const Record& ra = recordFor(a);
+        const Record& rb = recordFor(b);
+        switch (key) {
+            case SortKey::Sku: {
+                int order = inventory.resolve(a)->getSku().compare(inventory.resolve(b)->getSku());
+                return (order > 0) - (order < 0);
+            }
+            case SortKey::Name: {
+                int order = ra.name.compare(rb.name);
+                return (order > 0) - (order < 0);
+            }
+            case SortKey::Price:
+                return (ra.cents > rb.cents) - (ra.cents < rb.cents);
+            case SortKey::Quantity:
+                return (ra.quantity > rb.quantity) - (ra.quantity < rb.quantity);
+            case SortKey::Value:
+                return (ra.value() > rb.value()) - (ra.value() < rb.value());
+            case SortKey::Category: {
+                int order = ra.category.compare(rb.category);
+                return (order > 0) - (order < 0);
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * Single-key view order: value runs highest first, ties by slot index
+     */
+    bool viewLess(SortKey key, ProductHandle a, ProductHandle b) {
+        int order = compareKey(key, a, b);
+        if (order != 0) {
+            return key == SortKey::Value ? order > 0 : order < 0;
+        }
+        return a.index < b.index;
+    }
+
+    /**
+     * Spec order with literal directions; full ties are left to stable_sort
+     */
+    bool specLess(const SortSpec& spec, ProductHandle a, ProductHandle b) {
+        for (const SortSpec::Term& term : spec.getTerms()) {
+            int order = compareKey(term.key, a, b);
+            if (order != 0) {
+                return term.order == SortOrder::Ascending ? order < 0 : order > 0;
+            }
+        }
+        return false;
+    }
+
+    template <typename Predicate>
+    std::vector<ProductHandle> filter(const std::vector<ProductHandle>& display, Predicate predicate) {
+        std::vector<ProductHandle> result;
+        for (ProductHandle handle : display) {
+            if (predicate(recordFor(handle))) {
+                result.push_back(handle);
+            }
+        }
+        return result;
+    }
+
+    std::map<std::string, Record> records;
+    std::vector<std::string> removed;
+    std::mt19937 rng;
+    int nextSku;
+};
+
+void testAgainstModel() {
+    Model model;
+    // Grow past the radix threshold, shrink below it, then grow again
+    const std::size_t targets[] = {150, 10, 200};
+    for (std::size_t target : targets) {
+        for (int step = 0; step < 700; ++step) {
+            model.step(target);
+            model.checkAll();
+        }
+    }
+    CHECK(model.size() > 100);
+
+    QueryCacheStats stats = model.inventory.getQueryCacheStats();
+    CHECK(stats.hits + stats.misses > 0);
+    model.inventory.resetQueryCacheStats();
+    stats = model.inventory.getQueryCacheStats();
+    CHECK(stats.hits == 0 && stats.misses == 0 && stats.stale == 0 && stats.evictions == 0);
+}
+
+} // namespace
+
+int main() {
+    testAgainstModel();
+    return testExitCode("ModelTest");
+}
@@ -0,0 +1,236 @@
+/**
+ * @file PagingTest.cpp
+ * @brief Checks that paged listings and searches match their full results
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * Pages every paging API to the end with random page sizes while the
+ * inventory is edited, sorted and shrunk, and compares the concatenated
+ * pages with listing order, searchByName, searchByCategory and findAll.
+ * Also covers edits between pages and token rejection.
+ */
+
+#include "TestSupport.h"
+#include "Inventory.h"
+#include <functional>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+const char* const CATEGORIES[] = {"Software", "Tools", "Books", "Electronics", "Furniture"};
+const char* const WORDS[] = {"Pro", "Widget", "Drill", "Suite", "Chair", "Lamp"};
+
+using PageFetcher = std::function<bool(const std::string&, Inventory::Page&)>;
+
+/**
+ * Follows tokens until the last page and returns every handle in order
+ */
+std::vector<ProductHandle> fetchAllPages(const PageFetcher& fetch) {
+    std::vector<ProductHandle> all;
+    std::string token;
+    Inventory::Page page;
+    do {
+        if (!fetch(token, page)) {
+            CHECK(false && "page fetch rejected a fresh token");
+            break;
+        }
+        all.insert(all.end(), page.items.begin(), page.items.end());
+        token = page.nextToken;
+    } while (!token.empty());
+    return all;
+}
+
+class Fixture {
+public:
+    Fixture() : inventory("paging_test_unused.csv"), rng(2025), nextSku(0) {}
+
+    void addRandom() {
+        std::string sku = "K" + std::to_string(nextSku++);
+        std::string name = std::string(WORDS[rng() % 6]) + " " + WORDS[rng() % 6];
+        Money price = Money::fromCents(static_cast<std::int64_t>(rng() % 5000));
+        int quantity = static_cast<int>(rng() % 40);
+        const char* category = CATEGORIES[rng() % 5];
+        // A few products get a rare supplier, so some queries are very sparse
+        if (rng() % 2 == 0) {
+            const char* supplier = (rng() % 200 == 0) ? "Rare" : "Acme";
+            inventory.addProduct(new PhysicalProduct(sku, name, price, quantity, category, 1.0, supplier));
+        } else {
+            inventory.addProduct(new DigitalProduct(sku, name, price, quantity, category, "n/a", 1.0, "Single"));
+        }
+    }
+
+    std::string randomSku() {
+        return "K" + std::to_string(rng() % static_cast<unsigned>(nextSku));
+    }
+
+    Inventory inventory;
+    std::mt19937 rng;
+    int nextSku;
+};
+
+void testPagesMatchFullResults() {
+    Fixture fixture;
+    Inventory& inventory = fixture.inventory;
+    std::mt19937& rng = fixture.rng;
+    for (int i = 0; i < 1500; ++i) {
+        fixture.addRandom();
+    }
+
+    for (int step = 0; step < 120; ++step) {
+        switch (rng() % 5) {
+            case 0:
+                for (int i = 0; i < 20; ++i) {
+                    fixture.addRandom();
+                }
+                break;
+            case 1:
+                for (int i = 0; i < 100; ++i) {
+                    inventory.removeProduct(fixture.randomSku());
+                }
+                break;
+            case 2:
+                inventory.setName(fixture.randomSku(), std::string(WORDS[rng() % 6]) + " x");
+                break;
+            case 3:
+                inventory.setCategory(fixture.randomSku(), CATEGORIES[rng() % 5]);
+                break;
+            default:
+                inventory.sortBy(static_cast<SortKey>(rng() % SORT_KEY_COUNT));
+                break;
+        }
+
+        const size_t limit = 1 + rng() % 70;
+        const std::string term = std::string(WORDS[rng() % 6]).substr(0, 1 + rng() % 4);
+        const std::string category = std::string(CATEGORIES[rng() % 5]).substr(rng() % 3, 2 + rng() % 3);
+
+        CHECK(fetchAllPages([&](const std::string& token, Inventory::Page& page) {
+            return inventory.listPage(limit, token, page);
+        }) == inventory.findAll(Query::everything()));
+
+        CHECK(fetchAllPages([&](const std::string& token, Inventory::Page& page) {
+            return inventory.searchByNamePage(term, limit, token, page);
+        }) == inventory.searchByName(term));
+
+        CHECK(fetchAllPages([&](const std::string& token, Inventory::Page& page) {
+            return inventory.searchByCategoryPage(category, limit, token, page);
+        }) == inventory.searchByCategory(category));
+
+        // Index-driven, mixed, and sparse queries (the last rejects nearly every candidate)
+        std::vector<Query> queries = {
+            Query::allOf({Query::priceBelow(Money::fromCents(static_cast<std::int64_t>(rng() % 5000))),
+                          Query::quantityBetween(static_cast<int>(rng() % 10), 10 + static_cast<int>(rng() % 30))}),
+            Query::allOf({Query::category(CATEGORIES[rng() % 5]), Query::nameContains(term)}),
+            Query::allOf({Query::category(CATEGORIES[rng() % 5]), Query::negate(Query::supplier("Acme")),
+                          Query::type(ProductType::Physical)})
+        };
+        for (const Query& query : queries) {
+            CHECK(fetchAllPages([&](const std::string& token, Inventory::Page& page) {
+                return inventory.queryPage(query, limit, token, page);
+            }) == inventory.findAll(query));
+        }
+    }
+}
+
+void testEditsBetweenPages() {
+    Fixture fixture;
+    Inventory& inventory = fixture.inventory;
+    for (int i = 0; i < 500; ++i) {
+        fixture.addRandom();
+    }
+
+    // Removing the page's last product and adding new ones between pages
+    // must neither repeat a product nor skip one that was left alone
+    std::vector<ProductHandle> before = inventory.findAll(Query::everything());
+    std::set<std::pair<std::uint32_t, std::uint32_t>> seen;
+    std::set<std::uint32_t> removed;
+    Inventory::Page page;
+    std::string token;
+    do {
+        CHECK(inventory.listPage(37, token, page));
+        for (ProductHandle handle : page.items) {
+            CHECK(seen.insert({handle.index, handle.generation}).second);
+        }
+        token = page.nextToken;
+        if (!page.items.empty() && fixture.rng() % 2 == 0) {
+            ProductHandle last = page.items.back();
+            removed.insert(last.index);
+            inventory.removeProduct(inventory.resolve(last)->getSku());
+        }
+        fixture.addRandom();
+    } while (!token.empty());
+    for (ProductHandle handle : before) {
+        if (removed.count(handle.index) == 0) {
+            CHECK(seen.count({handle.index, handle.generation}) == 1);
+        }
+    }
+}
+
+void testPagingKeepsOtherCachedSearches() {
+    Fixture fixture;
+    Inventory& inventory = fixture.inventory;
+    for (int i = 0; i < 3000; ++i) {
+        fixture.addRandom();
+    }
+    inventory.setQueryCacheCapacity(8);
+    const std::vector<std::string> terms = {"pro", "wid", "dri", "sui", "cha"};
+    for (const std::string& term : terms) {
+        inventory.searchByName(term);
+    }
+
+    // A sparse query is paged through its index. Every page comes from one
+    // cache entry, so paging to the end evicts nothing
+    const Query query = Query::allOf({Query::category("Tools"), Query::quantityBetween(0, 0),
+                                      Query::type(ProductType::Physical)});
+    std::vector<ProductHandle> paged = fetchAllPages([&](const std::string& token, Inventory::Page& page) {
+        return inventory.queryPage(query, 1, token, page);
+    });
+    CHECK(paged.size() > 3 && paged == inventory.findAll(query));
+    CHECK(inventory.getQueryCacheStats().entries == terms.size() + 1);
+    CHECK(inventory.getQueryCacheStats().evictions == 0);
+    inventory.resetQueryCacheStats();
+    for (const std::string& term : terms) {
+        inventory.searchByName(term);
+    }
+    CHECK(inventory.getQueryCacheStats().hits == terms.size());
+
+    // A name page and searchByName share their entry
+    Inventory::Page page;
+    CHECK(inventory.searchByNamePage("PRO", 5, "", page));
+    CHECK(inventory.getQueryCacheStats().hits == terms.size() + 1);
+}
+
+void testTokenRejection() {
+    Inventory inventory("paging_test_unused.csv");
+    for (int i = 0; i < 10; ++i) {
+        inventory.addProduct(new PhysicalProduct("S" + std::to_string(i), "Item", Money::fromCents(100), 1,
+                                                 "Misc", 1.0, "Acme"));
+    }
+    Inventory::Page page;
+    CHECK(inventory.listPage(3, "", page) && page.items.size() == 3);
+    const std::string token = page.nextToken;
+
+    // The removed product's place holds until the order is rebuilt
+    inventory.removeProduct("S2");
+    CHECK(inventory.listPage(3, token, page) && page.items.size() == 3);
+    CHECK(!page.items.empty() && inventory.resolve(page.items[0])->getSku() == "S3");
+    inventory.sortBy(SortKey::Name);
+    CHECK(!inventory.listPage(3, token, page));
+
+    CHECK(!inventory.listPage(3, "not a token", page));
+    CHECK(!inventory.listPage(3, "1.2.3", page));
+    CHECK(!inventory.listPage(0, "", page));
+}
+
+} // namespace
+
+int main() {
+    testPagesMatchFullResults();
+    testEditsBetweenPages();
+    testPagingKeepsOtherCachedSearches();
+    testTokenRejection();
+    return testExitCode("PagingTest");
+}
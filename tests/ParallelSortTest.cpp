@@ -0,0 +1,59 @@
+/**
+ * @file ParallelSortTest.cpp
+ * @brief Checks that parallelSort matches std::sort for any thread count
+ * @author Ethan Trent
+ * @date 2025
+ */
+
+#include "TestSupport.h"
+#include "ParallelSort.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+void testMatchesStdSort() {
+    std::mt19937 rng(47);
+    for (std::size_t size : {std::size_t(0), std::size_t(100), PARALLEL_SORT_MIN_CHUNK * 3 + 17,
+                             PARALLEL_SORT_MIN_CHUNK * 9}) {
+        std::vector<std::uint32_t> values(size);
+        for (std::uint32_t& value : values) {
+            value = rng();
+        }
+        std::vector<std::uint32_t> expected = values;
+        std::sort(expected.begin(), expected.end());
+        for (unsigned threads = 1; threads <= 9; ++threads) {
+            std::vector<std::uint32_t> sorted = values;
+            parallelSort(sorted.begin(), sorted.end(), std::less<std::uint32_t>(), threads);
+            CHECK(sorted == expected);
+        }
+    }
+}
+
+void testWorkersJoinOnUnwind() {
+    // Leaving the scope by an exception must join, not terminate
+    std::atomic<int> finished(0);
+    try {
+        SortWorkers workers(4);
+        for (int i = 0; i < 4; ++i) {
+            workers.run([&finished]() {
+                finished++;
+            });
+        }
+        throw std::runtime_error("comparator failed on the calling thread");
+    } catch (const std::runtime_error&) {
+    }
+    CHECK(finished == 4);
+}
+
+} // namespace
+
+int main() {
+    testMatchesStdSort();
+    testWorkersJoinOnUnwind();
+    return testExitCode("ParallelSortTest");
+}
@@ -0,0 +1,82 @@
+/**
+ * @file QueryTest.cpp
+ * @brief Checks the type-specific query leaves against direct field tests
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * Weight, file size and download link tests have no index, so findAll
+ * runs them through a scan or as the residual of an indexed AND; both
+ * must agree with comparing the fields directly.
+ */
+
+#include "TestSupport.h"
+#include "Inventory.h"
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+const char* const HOSTS[] = {"https://dl.example.com/", "https://CDN.Example.org/", "ftp://files.test/"};
+
+void testMeasureAndLinkLeaves() {
+    Inventory inventory("query_test_unused.csv");
+    std::mt19937 rng(41);
+    for (int i = 0; i < 600; ++i) {
+        std::string sku = "Q" + std::to_string(i);
+        Money price = Money::fromCents(static_cast<std::int64_t>(rng() % 10000));
+        const char* category = (i % 3 == 0) ? "Software" : "Tools";
+        if (rng() % 2 == 0) {
+            double weight = static_cast<double>(rng() % 400) / 10.0;
+            inventory.addProduct(new PhysicalProduct(sku, "Item", price, 1, category, weight, "Acme"));
+        } else {
+            double size = static_cast<double>(rng() % 2000) / 4.0;
+            std::string link = std::string(HOSTS[rng() % 3]) + sku;
+            inventory.addProduct(new DigitalProduct(sku, "App", price, 1, category, link, size, "Single"));
+        }
+    }
+
+    const Query weight = Query::weightBetween(5.0, 12.5);
+    const Query fileSize = Query::fileSizeBetween(100.0, 250.0);
+    const Query link = Query::downloadLinkContains("example");
+    for (const Query& leaf : {weight, fileSize, link}) {
+        std::vector<ProductHandle> expected;
+        std::vector<ProductHandle> expectedSoftware;
+        for (ProductHandle handle : inventory.findAll(Query::everything())) {
+            const Product* product = inventory.resolve(handle);
+            bool match = false;
+            if (leaf.kind() == Query::Kind::WeightRange) {
+                const auto* physical = dynamic_cast<const PhysicalProduct*>(product);
+                match = physical != nullptr && physical->getWeight() >= 5.0 && physical->getWeight() <= 12.5;
+            } else {
+                const auto* digital = dynamic_cast<const DigitalProduct*>(product);
+                if (digital != nullptr && leaf.kind() == Query::Kind::FileSizeRange) {
+                    match = digital->getFileSizeMB() >= 100.0 && digital->getFileSizeMB() <= 250.0;
+                } else if (digital != nullptr) {
+                    match = digital->getDownloadLink().find("xample") != std::string::npos;
+                }
+            }
+            if (match) {
+                expected.push_back(handle);
+                if (product->getCategory() == "Software") {
+                    expectedSoftware.push_back(handle);
+                }
+            }
+        }
+        CHECK(!expected.empty());
+        CHECK(inventory.findAll(leaf) == expected);
+        // Driven by the category bitmap, with the leaf checked per candidate
+        CHECK(inventory.findAll(Query::category("Software") && leaf) == expectedSoftware);
+    }
+
+    CHECK(weight.toString() == "weight in [5, 12.5] lbs");
+    CHECK(fileSize.toString() == "file size in [100, 250] MB");
+    CHECK(link.toString() == "download link contains \"example\"");
+}
+
+} // namespace
+
+int main() {
+    testMeasureAndLinkLeaves();
+    return testExitCode("QueryTest");
+}
@@ -0,0 +1,47 @@
+/**
+ * @file TestSupport.h
+ * @brief Minimal check macro for the SmallBiz test programs
+ * @author Ethan Trent
+ * @date 2025
+ *
+ * Each file in tests/ is a standalone program run by "make test". CHECK
+ * reports a failed condition with its location and keeps going, and
+ * testExitCode() turns the failure count into the program's exit status.
+ */
+
+#ifndef TESTSUPPORT_H
+#define TESTSUPPORT_H
+
+#include <iostream>
+
+/// Failed checks so far in this test program
+inline int& testFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+/// Report a failed condition without stopping the program (unaffected by NDEBUG)
+#define CHECK(condition)                                                        \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK failed: "      \
+                      << #condition << std::endl;                               \
+            testFailures()++;                                                   \
+        }                                                                       \
+    } while (0)
+
+/**
+ * @brief Print a summary line and produce the program's exit status
+ * @param name Test program name
+ * @return 0 if every check passed, 1 otherwise
+ */
+inline int testExitCode(const char* name) {
+    if (testFailures() == 0) {
+        std::cout << "[PASS] " << name << std::endl;
+        return 0;
+    }
+    std::cout << "[FAIL] " << name << ": " << testFailures() << " check(s) failed" << std::endl;
+    return 1;
+}
+
+#endif // TESTSUPPORT_H